@@ -2,13 +2,19 @@
 
 #include <rpp/rpp.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <random>
 #include <span>
 #include <string_view>
+#include <thread>
 #include <tuple>
+#include <vector>
 #ifdef RPP_BUILD_RXCPP
     #include <rxcpp/rx.hpp>
 #endif
@@ -118,6 +124,115 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int) {});
             });
         }
+
+        SECTION("disposable_wrapper make + as_weak + 10 x is_disposed via weak")
+        {
+            TEST_RPP([&]() {
+                const auto d    = rpp::composite_disposable_wrapper::make();
+                const auto weak = d.as_weak();
+                for (size_t i = 0; i < 10; ++i)
+                    ankerl::nanobench::doNotOptimizeAway(weak.is_disposed());
+            });
+        }
+
+        SECTION("disposable_wrapper 10 x copy + is_disposed")
+        {
+            const auto d = rpp::composite_disposable_wrapper::make();
+            TEST_RPP([&]() {
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    const auto copy = d;
+                    ankerl::nanobench::doNotOptimizeAway(copy.is_disposed());
+                }
+            });
+        }
+
+        SECTION("composite_disposable add 10'000 + remove in reverse order")
+        {
+            std::vector<rpp::composite_disposable_wrapper> disposables{};
+            for (size_t i = 0; i < 10'000; ++i)
+                disposables.push_back(rpp::composite_disposable_wrapper::make());
+
+            TEST_RPP([&]() {
+                auto composite = rpp::composite_disposable_wrapper::make();
+                for (const auto& d : disposables)
+                    composite.add(d);
+                for (auto it = disposables.rbegin(); it != disposables.rend(); ++it)
+                    composite.remove(*it);
+                ankerl::nanobench::doNotOptimizeAway(composite);
+            });
+        }
+
+        SECTION("composite_disposable 4 threads x 10'000 add + remove")
+        {
+            TEST_RPP([&]() {
+                auto composite = rpp::composite_disposable_wrapper::make();
+
+                std::vector<std::thread> threads{};
+                for (size_t t = 0; t < 4; ++t)
+                {
+                    threads.emplace_back([&] {
+                        const auto d = rpp::composite_disposable_wrapper::make();
+                        for (size_t i = 0; i < 10'000; ++i)
+                        {
+                            composite.add(d);
+                            composite.remove(d);
+                        }
+                    });
+                }
+                for (auto& thread : threads)
+                    thread.join();
+                composite.dispose();
+            });
+        }
+
+        SECTION("refcount_disposable 1'000 x add_ref + dispose")
+        {
+            TEST_RPP([&]() {
+                auto refcount = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+                auto keeper   = refcount.lock()->add_ref();
+                for (size_t i = 0; i < 1'000; ++i)
+                    refcount.lock()->add_ref().dispose();
+                keeper.dispose();
+                ankerl::nanobench::doNotOptimizeAway(refcount);
+            });
+        }
+
+        SECTION("group_by 1'000 keys + subscribe to each group")
+        {
+            TEST_RPP([&]() {
+                rpp::source::create<int>([](const auto& obs) {
+                    for (int i = 0; i < 1'000; ++i)
+                        obs.on_next(i);
+                    obs.on_completed();
+                })
+                    | rpp::operators::group_by([](int v) { return v; })
+                    | rpp::operators::subscribe([](const auto& group) { group.subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }); });
+            });
+        }
+
+        SECTION("subscription per request: dynamic + merge_with + switch_on_next + subscribe")
+        {
+            TEST_RPP([&]() {
+                rpp::dynamic_observable<int>{rpp::source::just(1)}
+                    | rpp::operators::merge_with(rpp::source::just(2))
+                    | rpp::operators::map([](int v) { return rpp::source::just(v); })
+                    | rpp::operators::switch_on_next()
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        SECTION("subscription per request: dynamic + merge_with + switch_on_next + subscribe inside use_arena")
+        {
+            TEST_RPP([&]() {
+                const rpp::memory_model::use_arena arena{};
+                rpp::dynamic_observable<int>{rpp::source::just(1)}
+                    | rpp::operators::merge_with(rpp::source::just(2))
+                    | rpp::operators::map([](int v) { return rpp::source::just(v); })
+                    | rpp::operators::switch_on_next()
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
     }; // BENCHMARK("General")
 
     BENCHMARK("Sources")
@@ -238,6 +353,14 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             });
         }
 
+        SECTION("instrumented current_thread scheduler create worker + schedule")
+        {
+            const auto scheduler = rpp::schedulers::instrumented{rpp::schedulers::current_thread{}, std::make_shared<rpp::schedulers::scheduler_metrics>()};
+            TEST_RPP([&]() {
+                scheduler.create_worker().schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+            });
+        }
+
         SECTION("current_thread scheduler create worker + schedule + recursive schedule")
         {
             TEST_RPP(
@@ -266,6 +389,569 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     });
                 });
         }
+
+        SECTION("run_loop scheduler create worker + schedule + dispatch")
+        {
+            rpp::schedulers::run_loop run_loop{};
+            TEST_RPP([&]() {
+                run_loop.create_worker().schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+                run_loop.dispatch_if_ready();
+            });
+            TEST_RXCPP([&]() {
+                rxcpp::schedulers::run_loop rl{};
+                rxcpp::observe_on_run_loop(rl).create_coordinator().get_worker().schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                rl.dispatch();
+            });
+        }
+
+        const auto run_loop_1000_ready = [&](const auto& dispatch) {
+            rpp::schedulers::run_loop run_loop{};
+            const auto                worker  = run_loop.create_worker();
+            const auto                handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            TEST_RPP([&]() {
+                for (size_t i = 0; i < 1'000; ++i)
+                    worker.schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, handler);
+                dispatch(run_loop);
+            });
+        };
+
+        SECTION("run_loop 1000 ready schedulables + dispatch_if_ready in loop")
+        {
+            run_loop_1000_ready([](const rpp::schedulers::run_loop& run_loop) {
+                while (run_loop.is_any_ready_schedulable())
+                    run_loop.dispatch_if_ready();
+            });
+        }
+
+        SECTION("run_loop 1000 ready schedulables + dispatch_batch")
+        {
+            run_loop_1000_ready([](const rpp::schedulers::run_loop& run_loop) {
+                run_loop.dispatch_batch();
+            });
+        }
+
+        for (const size_t pending_count : {size_t{10'000}, size_t{1'000'000}})
+        {
+            const auto name = "schedulables queue with " + std::to_string(pending_count) + " pending timers - pop + emplace";
+            SECTION(name.c_str())
+            {
+                // "hold" model: queue keeps same size, each iteration extracts earliest timer and re-schedules it to random point in the future
+                rpp::schedulers::details::schedulables_queue<rpp::schedulers::immediate::worker_strategy> queue{};
+                const auto                                                                                fn = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+                const auto                                                                                handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+
+                std::minstd_rand                        random{};
+                std::uniform_int_distribution<uint32_t> delay{0, static_cast<uint32_t>(pending_count)};
+                const auto                              start = rpp::schedulers::clock_type::now();
+                for (size_t i = 0; i < pending_count; ++i)
+                    queue.emplace(start + std::chrono::microseconds{delay(random)}, fn, handler);
+
+                TEST_RPP([&]() {
+                    auto top = queue.pop();
+                    queue.emplace(top->get_timepoint() + std::chrono::microseconds{delay(random)}, std::move(top));
+                });
+            }
+        }
+
+        SECTION("schedulables queue with 1'000 alive timers - emplace of 1'000 30s timers disposed right after scheduling")
+        {
+            // "timeout(30s)" model: most of timers are disposed long before they reach the top of the queue
+            rpp::schedulers::details::schedulables_queue<rpp::schedulers::immediate::worker_strategy> queue{};
+            const auto                                                                                fn = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+            const auto                                                                                alive_handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+
+            const auto start = rpp::schedulers::clock_type::now();
+            for (size_t i = 0; i < 1'000; ++i)
+                queue.emplace(start + std::chrono::seconds{30}, fn, alive_handler);
+
+            TEST_RPP([&]() {
+                for (size_t i = 0; i < 1'000; ++i)
+                {
+                    const auto handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+                    queue.emplace(rpp::schedulers::clock_type::now() + std::chrono::seconds{30}, fn, handler);
+                    handler.on_completed();
+                }
+            });
+        }
+
+        SECTION("new_thread 4 producers x 10'000 zero-delay schedulables to one worker")
+        {
+            constexpr size_t producers_count = 4;
+            constexpr size_t tasks_count     = 10'000;
+
+            const auto         worker  = rpp::schedulers::new_thread::create_worker();
+            const auto         handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            std::atomic_size_t processed{};
+
+            TEST_RPP([&]() {
+                processed.store(0);
+
+                std::vector<std::thread> producers{};
+                for (size_t i = 0; i < producers_count; ++i)
+                {
+                    producers.emplace_back([&] {
+                        for (size_t j = 0; j < tasks_count; ++j)
+                        {
+                            worker.schedule([&processed](const auto&) {
+                                processed.fetch_add(1, std::memory_order_relaxed);
+                                return rpp::schedulers::optional_delay_from_now{};
+                            },
+                                            handler);
+                        }
+                    });
+                }
+                for (auto& producer : producers)
+                    producer.join();
+
+                while (processed.load() != producers_count * tasks_count)
+                    std::this_thread::yield();
+            });
+        }
+
+        // ping-pong handoff: each iteration schedules schedulable to idle thread and waits till it is executed
+        const std::pair<const char*, rpp::schedulers::idle_strategy> idle_strategies[] = {{"blocking", rpp::schedulers::idle_strategy::blocking()},
+                                                                                          {"busy_spin", rpp::schedulers::idle_strategy::busy_spin()},
+                                                                                          {"spin_then_yield", rpp::schedulers::idle_strategy::spin_then_yield()},
+                                                                                          {"spin_then_park", rpp::schedulers::idle_strategy::spin_then_park()}};
+        for (const auto& [idle_name, idle] : idle_strategies)
+        {
+            const auto new_thread_name = "new_thread handoff to idle thread with " + std::string{idle_name} + " idle strategy";
+            SECTION(new_thread_name.c_str())
+            {
+                rpp::schedulers::thread_config config{};
+                config.idle = idle;
+
+                const auto       worker  = rpp::schedulers::new_thread::create_worker(config);
+                const auto       handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+                std::atomic_bool done{};
+
+                TEST_RPP([&]() {
+                    done.store(false);
+                    worker.schedule([&](const auto&) {
+                        done.store(true, std::memory_order_release);
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                    handler);
+
+                    while (!done.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                });
+            }
+
+            const auto run_loop_name = "run_loop handoff to idle dispatching thread with " + std::string{idle_name} + " idle strategy";
+            SECTION(run_loop_name.c_str())
+            {
+                const auto       scheduler = rpp::schedulers::run_loop{idle};
+                const auto       worker    = scheduler.create_worker();
+                const auto       handler   = rpp::make_lambda_observer([](int) {}).as_dynamic();
+                std::atomic_bool done{};
+                std::atomic_bool stop{};
+
+                std::thread dispatcher{[&] {
+                    while (!stop.load())
+                        scheduler.dispatch();
+                }};
+
+                TEST_RPP([&]() {
+                    done.store(false);
+                    worker.schedule([&](const auto&) {
+                        done.store(true, std::memory_order_release);
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                    handler);
+
+                    while (!done.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                });
+
+                stop.store(true);
+                worker.schedule([](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, handler);
+                dispatcher.join();
+            }
+        }
+
+        // timer jitter: each iteration schedules schedulable with 200us delay and waits till it is executed, so everything above 200us is lateness of timer
+        constexpr auto timer_delay = std::chrono::microseconds{200};
+
+        const std::pair<const char*, rpp::schedulers::timer_precision> timer_precisions[] = {{"standard", rpp::schedulers::timer_precision::standard()},
+                                                                                             {"precise", rpp::schedulers::timer_precision::precise()}};
+        for (const auto& [timer_name, timer] : timer_precisions)
+        {
+            const auto new_thread_name = "new_thread 200us delayed schedulable with " + std::string{timer_name} + " timer";
+            SECTION(new_thread_name.c_str())
+            {
+                rpp::schedulers::thread_config config{};
+                config.timer = timer;
+
+                const auto       worker  = rpp::schedulers::new_thread::create_worker(config);
+                const auto       handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+                std::atomic_bool done{};
+
+                TEST_RPP([&]() {
+                    done.store(false);
+                    worker.schedule(rpp::schedulers::clock_type::now() + timer_delay, [&](const auto&) {
+                        done.store(true, std::memory_order_release);
+                        return rpp::schedulers::optional_delay_to{};
+                    },
+                                    handler);
+
+                    while (!done.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                });
+            }
+
+            const auto current_thread_name = "current_thread 200us delayed schedulable with " + std::string{timer_name} + " timer";
+            SECTION(current_thread_name.c_str())
+            {
+                timer.apply_to_current_thread();
+
+                const auto worker  = rpp::schedulers::current_thread::create_worker();
+                const auto handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+
+                TEST_RPP([&]() {
+                    worker.schedule(rpp::schedulers::clock_type::now() + timer_delay, [](const auto&) { return rpp::schedulers::optional_delay_to{}; }, handler);
+                });
+
+                rpp::schedulers::timer_precision::standard().apply_to_current_thread();
+            }
+        }
+
+        const auto clock_now_inside_schedulable = [&](const auto& scheduler) {
+            const auto worker  = scheduler.create_worker();
+            const auto handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            TEST_RPP([&]() {
+                worker.schedule([&worker](const auto&) {
+                    for (size_t i = 0; i < 1'000; ++i)
+                        ankerl::nanobench::doNotOptimizeAway(worker.now());
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                handler);
+            });
+        };
+
+        SECTION("1000 x worker.now() inside current_thread schedulable with precise_clock")
+        {
+            clock_now_inside_schedulable(rpp::schedulers::with_clock<rpp::schedulers::precise_clock, rpp::schedulers::current_thread>{});
+        }
+
+        SECTION("1000 x worker.now() inside current_thread schedulable with coarse_clock")
+        {
+            clock_now_inside_schedulable(rpp::schedulers::with_clock<rpp::schedulers::coarse_clock, rpp::schedulers::current_thread>{});
+        }
+
+        SECTION("1000 x worker.now() inside current_thread schedulable with tsc_clock")
+        {
+            clock_now_inside_schedulable(rpp::schedulers::with_clock<rpp::schedulers::tsc_clock, rpp::schedulers::current_thread>{});
+        }
+
+        SECTION("1000 x worker.now() inside current_thread schedulable with cached_clock")
+        {
+            clock_now_inside_schedulable(rpp::schedulers::with_clock<rpp::schedulers::cached_clock, rpp::schedulers::current_thread>{});
+        }
+
+        SECTION("virtual_time 1000 timers with different delays + run")
+        {
+            const auto scheduler = rpp::schedulers::virtual_time{};
+            const auto worker    = scheduler.create_worker();
+            const auto handler   = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            size_t     executed{};
+
+            TEST_RPP([&]() {
+                for (size_t i = 0; i < 1'000; ++i)
+                {
+                    worker.schedule(std::chrono::milliseconds{(i * 7919) % 1'000}, [&executed](const auto&) {
+                        ++executed;
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                    handler);
+                }
+                ankerl::nanobench::doNotOptimizeAway(scheduler.run());
+            });
+        }
+
+        SECTION("virtual_time 1000 periodic timers x 10 ticks via advance_by")
+        {
+            const auto scheduler = rpp::schedulers::virtual_time{};
+            const auto worker    = scheduler.create_worker();
+            const auto handler   = rpp::make_lambda_observer([](int) {}).as_dynamic();
+
+            for (size_t i = 0; i < 1'000; ++i)
+            {
+                worker.schedule(std::chrono::milliseconds{i % 10}, [](const auto&) {
+                    return rpp::schedulers::optional_delay_from_this_timepoint{std::chrono::milliseconds{10}};
+                },
+                                handler);
+            }
+
+            TEST_RPP([&]() {
+                ankerl::nanobench::doNotOptimizeAway(scheduler.advance_by(std::chrono::milliseconds{100}));
+            });
+        }
+
+        SECTION("new_thread subscribe_on + as_blocking churn")
+        {
+            TEST_RPP([&]() {
+                rpp::source::just(1)
+                    | rpp::operators::subscribe_on(rpp::schedulers::new_thread{})
+                    | rpp::operators::as_blocking()
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        SECTION("cached_new_thread subscribe_on + as_blocking churn")
+        {
+            const auto scheduler = rpp::schedulers::cached_new_thread{};
+            TEST_RPP([&]() {
+                rpp::source::just(1)
+                    | rpp::operators::subscribe_on(scheduler)
+                    | rpp::operators::as_blocking()
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        // skewed load: one worker receives "heavy" CPU-bound schedulable, while other workers receive a lot of light ones. Measures time till all of them processed
+        const auto skewed_load = [&](const auto& scheduler) {
+            constexpr size_t workers_count     = 8;
+            constexpr size_t light_tasks_count = 64;
+
+            std::vector<decltype(scheduler.create_worker())> workers{};
+            for (size_t i = 0; i < workers_count; ++i)
+                workers.push_back(scheduler.create_worker());
+
+            const auto         handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            std::atomic_size_t pending{};
+
+            TEST_RPP([&]() {
+                pending.store(light_tasks_count + 1);
+                workers[0].schedule([&pending](const auto&) {
+                    const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds{200};
+                    while (std::chrono::steady_clock::now() < until)
+                    {
+                    }
+                    pending.fetch_sub(1);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                    handler);
+
+                for (size_t i = 0; i < light_tasks_count; ++i)
+                {
+                    workers[1 + i % (workers_count - 1)].schedule([&pending](const auto&) {
+                        pending.fetch_sub(1);
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                                                 handler);
+                }
+
+                while (pending.load() != 0)
+                    std::this_thread::yield();
+            });
+        };
+
+        SECTION("thread_pool{4} skewed load: 1 heavy + 64 light schedulables over 8 workers")
+        {
+            skewed_load(rpp::schedulers::thread_pool{4});
+        }
+
+        SECTION("computational skewed load: 1 heavy + 64 light schedulables over 8 workers")
+        {
+            skewed_load(rpp::schedulers::computational{});
+        }
+
+        SECTION("work_stealing_pool{4} skewed load: 1 heavy + 64 light schedulables over 8 workers")
+        {
+            skewed_load(rpp::schedulers::work_stealing_pool{4});
+        }
+
+        // blocking load: each worker executes schedulable blocked on 1ms sleep (like IO call). Measures time till all of them processed
+        const auto blocking_load = [&](const auto& scheduler) {
+            constexpr size_t workers_count = 16;
+
+            const auto         handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            std::atomic_size_t pending{};
+
+            TEST_RPP([&]() {
+                pending.store(workers_count);
+                for (size_t i = 0; i < workers_count; ++i)
+                {
+                    scheduler.create_worker().schedule([&pending](const auto&) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                        pending.fetch_sub(1);
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                                       handler);
+                }
+
+                while (pending.load() != 0)
+                    std::this_thread::yield();
+            });
+        };
+
+        SECTION("thread_pool{4} blocking load: 16 workers x 1ms blocking call")
+        {
+            blocking_load(rpp::schedulers::thread_pool{4});
+        }
+
+        SECTION("elastic{4, 64} blocking load: 16 workers x 1ms blocking call")
+        {
+            blocking_load(rpp::schedulers::elastic{4, 64});
+        }
+
+        SECTION("strand over thread_pool{4} skewed load: 1 heavy + 64 light schedulables over 8 workers")
+        {
+            skewed_load(rpp::schedulers::strand{rpp::schedulers::thread_pool{4}});
+        }
+
+        SECTION("strand over work_stealing_pool{4}: 10'000 strands x 10 schedulables")
+        {
+            const auto       scheduler     = rpp::schedulers::strand{rpp::schedulers::work_stealing_pool{4}};
+            constexpr size_t strands_count = 10'000;
+            constexpr size_t tasks_count   = 10;
+
+            std::vector<decltype(scheduler.create_worker())> workers{};
+            for (size_t i = 0; i < strands_count; ++i)
+                workers.push_back(scheduler.create_worker());
+
+            const auto         handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            std::atomic_size_t pending{};
+
+            TEST_RPP([&]() {
+                pending.store(strands_count * tasks_count);
+                for (size_t t = 0; t < tasks_count; ++t)
+                {
+                    for (const auto& worker : workers)
+                    {
+                        worker.schedule([&pending](const auto&) {
+                            pending.fetch_sub(1);
+                            return rpp::schedulers::optional_delay_from_now{};
+                        },
+                                        handler);
+                    }
+                }
+
+                while (pending.load() != 0)
+                    std::this_thread::yield();
+            });
+        }
+
+        // heartbeat under flood: each iteration floods worker with 1'000 x 5us schedulables and schedules 1ms timer with provided priority
+        for (const auto priority : {rpp::schedulers::priority::normal, rpp::schedulers::priority::high})
+        {
+            const auto name = std::string{"new_thread 1ms timer with "} + (priority == rpp::schedulers::priority::high ? "high" : "normal") + " priority under flood of 1'000 x 5us schedulables";
+            SECTION(name.c_str())
+            {
+                const auto         worker  = rpp::schedulers::new_thread::create_worker();
+                const auto         handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+                std::atomic_size_t pending{};
+
+                TEST_RPP([&]() {
+                    pending.store(1'001);
+                    for (size_t i = 0; i < 1'000; ++i)
+                    {
+                        worker.schedule([&pending](const auto&) {
+                            const auto end = rpp::schedulers::clock_type::now() + std::chrono::microseconds{5};
+                            while (rpp::schedulers::clock_type::now() < end)
+                            {
+                            }
+                            pending.fetch_sub(1);
+                            return rpp::schedulers::optional_delay_from_now{};
+                        },
+                                        handler);
+                    }
+
+                    worker.schedule(priority, rpp::schedulers::clock_type::now() + std::chrono::milliseconds{1}, [&pending](const auto&) {
+                        pending.fetch_sub(1);
+                        return rpp::schedulers::optional_delay_to{};
+                    },
+                                    handler);
+
+                    while (pending.load() != 0)
+                        std::this_thread::yield();
+                });
+            }
+        }
+
+        // recursive schedulable monopolizing thread: 100'000 sequential executions, timer scheduled from inside of it via current_thread can't interrupt it without time slice
+        const std::pair<const char*, rpp::schedulers::time_slice> slices[] = {{"unlimited", rpp::schedulers::time_slice::unlimited()},
+                                                                              {"50us", rpp::schedulers::time_slice::of(std::chrono::microseconds{50})}, {"1000 items", rpp::schedulers::time_slice::items(1000)}};
+        for (const auto& [slice_name, slice] : slices)
+        {
+            const auto name = "new_thread 100'000 x recursive schedulable + inner 100us timer with " + std::string{slice_name} + " time slice";
+            SECTION(name.c_str())
+            {
+                rpp::schedulers::thread_config config{};
+                config.slice = slice;
+
+                const auto       worker  = rpp::schedulers::new_thread::create_worker(config);
+                const auto       handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+                std::atomic_bool done{};
+
+                TEST_RPP([&]() {
+                    done.store(false);
+                    worker.schedule([&, count = size_t{}](const auto&) mutable -> rpp::schedulers::optional_delay_from_now {
+                        if (count == 0)
+                        {
+                            rpp::schedulers::current_thread::create_worker().schedule(std::chrono::microseconds{100}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, handler);
+                        }
+                        if (++count == 100'000)
+                        {
+                            done.store(true, std::memory_order_release);
+                            return std::nullopt;
+                        }
+                        return rpp::schedulers::delay_from_now{};
+                    },
+                                    handler);
+
+                    while (!done.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                });
+            }
+        }
+
+        // throughput of scheduling from 8 producer threads to copies of the same worker. Reported per one schedulable via batch
+        const auto schedule_from_producers = [&](const auto& scheduler) {
+            constexpr size_t producers_count = 8;
+            constexpr size_t per_producer    = 10'000;
+
+            const auto         worker  = scheduler.create_worker();
+            const auto         handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            std::atomic_size_t pending{};
+
+            bench.batch(producers_count * per_producer);
+            TEST_RPP([&]() {
+                pending.store(producers_count * per_producer);
+
+                std::vector<std::thread> producers{};
+                for (size_t p = 0; p < producers_count; ++p)
+                {
+                    producers.emplace_back([&, worker] {
+                        for (size_t i = 0; i < per_producer; ++i)
+                        {
+                            worker.schedule([&pending](const auto&) {
+                                pending.fetch_sub(1, std::memory_order_relaxed);
+                                return rpp::schedulers::optional_delay_from_now{};
+                            },
+                                            handler);
+                        }
+                    });
+                }
+                for (auto& producer : producers)
+                    producer.join();
+
+                while (pending.load() != 0)
+                    std::this_thread::yield();
+            });
+            bench.batch(1);
+        };
+
+        SECTION("new_thread 8 producers x 10'000 schedulables")
+        {
+            schedule_from_producers(rpp::schedulers::new_thread{});
+        }
+
+        SECTION("thread_pool{4} 8 producers x 10'000 schedulables")
+        {
+            schedule_from_producers(rpp::schedulers::thread_pool{4});
+        }
     } // BENCHMARK("Schedulers")
 
     BENCHMARK("Combining Operators")
@@ -22,3 +22,5 @@
 #else
     #define RPP_NO_UNIQUE_ADDRESS [[no_unique_address]]
 #endif
+
+// Define RPP_SINGLE_THREADED (for whole program) to replace all atomics and mutexes of library with plain variables and no-op locks. Schedulers owning threads are not available in such mode.
@@ -15,6 +15,7 @@
 #include <rpp/disposables/details/container.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/interface_composite_disposable.hpp>
+#include <rpp/utils/utils.hpp>
 
 #include <atomic>
 
@@ -57,6 +58,8 @@ namespace rpp
 
                 if (expected == State::Disposed)
                     return;
+
+                wait_for_edit_end();
             }
         }
 
@@ -79,11 +82,10 @@ namespace rpp
                     }
                     catch (...)
                     {
-                        m_current_state.store(State::None, std::memory_order::seq_cst);
+                        finish_edit();
                         throw;
                     }
-                    // need to propogate disposables state changing to others
-                    m_current_state.store(State::None, std::memory_order::seq_cst);
+                    finish_edit();
                     return;
                 }
 
@@ -92,6 +94,8 @@ namespace rpp
                     disposable.dispose();
                     return;
                 }
+
+                wait_for_edit_end();
             }
         }
 
@@ -109,16 +113,17 @@ namespace rpp
                     }
                     catch (...)
                     {
-                        m_current_state.store(State::None, std::memory_order::seq_cst);
+                        finish_edit();
                         throw;
                     }
-                    // need to propogate disposables state changing to others
-                    m_current_state.store(State::None, std::memory_order::seq_cst);
+                    finish_edit();
                     return;
                 }
 
                 if (expected == State::Disposed)
                     return;
+
+                wait_for_edit_end();
             }
         }
 
@@ -137,22 +142,37 @@ namespace rpp
                     }
                     catch (...)
                     {
-                        m_current_state.store(State::None, std::memory_order::seq_cst);
+                        finish_edit();
                         throw;
                     }
-                    // need to propogate disposables state changing to others
-                    m_current_state.store(State::None, std::memory_order::seq_cst);
+                    finish_edit();
                     return;
                 }
 
                 if (expected == State::Disposed)
                     return;
+
+                wait_for_edit_end();
             }
         }
 
     protected:
         virtual void composite_dispose_impl(interface_disposable::Mode) noexcept {}
 
+    private:
+        void finish_edit()
+        {
+            // need to propogate disposables state changing to others
+            m_current_state.store(State::None, std::memory_order::seq_cst);
+            m_current_state.notify_all();
+        }
+
+        // other thread edits disposables right now: block till it finishes instead of spinning (cheap when nobody waits)
+        void wait_for_edit_end() const
+        {
+            m_current_state.wait(State::Edit, std::memory_order::seq_cst);
+        }
+
     private:
         enum class State : uint8_t
         {
@@ -161,17 +181,17 @@ namespace rpp
             Disposed // permanent state after dispose
         };
 
-        Container          m_disposables{};
-        std::atomic<State> m_current_state{};
+        Container                 m_disposables{};
+        rpp::utils::atomic<State> m_current_state{};
     };
 
     /**
      * @brief Disposable which can keep some other sub-disposables. When this root disposable is disposed, then all sub-disposables would be disposed too.
-     * @note By default uses vector as internal storage
+     * @note By default uses vector indexed by addresses of disposables as internal storage, so `remove` is O(1) even for large amount of sub-disposables
      *
      * @ingroup disposables
      */
-    class composite_disposable : public composite_disposable_impl<rpp::details::disposables::dynamic_disposables_container<0>>
+    class composite_disposable : public composite_disposable_impl<rpp::details::disposables::indexed_disposables_container>
     {
     };
 } // namespace rpp
@@ -13,6 +13,7 @@
 #include <rpp/disposables/fwd.hpp>
 
 #include <rpp/disposables/interface_disposable.hpp>
+#include <rpp/utils/utils.hpp>
 
 #include <atomic>
 
@@ -44,7 +45,7 @@ namespace rpp::details
         virtual void base_dispose_impl(interface_disposable::Mode mode) noexcept = 0;
 
     private:
-        std::atomic_bool m_disposed{};
+        rpp::utils::atomic<bool> m_disposed{};
     };
 
     using base_disposable           = base_disposable_impl<interface_disposable>;
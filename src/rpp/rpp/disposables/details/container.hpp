@@ -13,6 +13,9 @@
 #include <rpp/utils/exceptions.hpp>
 
 #include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 namespace rpp::details::disposables
@@ -67,6 +70,137 @@ namespace rpp::details::disposables
         }
     };
 
+    /**
+     * @brief Container with O(1) `push_back` and `remove`. Disposables are kept in vector and, after exceeding of `linear_search_limit` elements, indexed by open addressing hash table from address of disposable to its position in vector.
+     * @details Small containers behave as plain vector, while removal from large ones (like inner subscriptions of `merge`/`flat_map`) doesn't scan whole container. Removal from indexed container moves last disposable to the place of removed one, so order of disposing is not preserved after it.
+     */
+    class indexed_disposables_container
+    {
+        static constexpr size_t linear_search_limit = 16;
+        static constexpr size_t empty_slot          = std::numeric_limits<size_t>::max();
+
+    public:
+        indexed_disposables_container() = default;
+
+        void push_back(const rpp::disposable_wrapper& d)
+        {
+            push_back(rpp::disposable_wrapper{d});
+        }
+
+        void push_back(rpp::disposable_wrapper&& d)
+        {
+            m_data.push_back(std::move(d));
+
+            if (m_index.empty() ? m_data.size() > linear_search_limit : m_data.size() * 2 > m_index.size())
+                rebuild_index();
+            else if (!m_index.empty())
+                insert_to_index(m_data.size() - 1);
+        }
+
+        void remove(const rpp::disposable_wrapper& d)
+        {
+            const auto* key = d.get_id();
+            if (m_index.empty())
+            {
+                m_data.erase(std::remove_if(m_data.begin(), m_data.end(), [key](const rpp::disposable_wrapper& e) { return e.get_id() == key; }), m_data.end());
+                return;
+            }
+
+            for (size_t slot = find_slot(key); slot != empty_slot; slot = find_slot(key))
+            {
+                const size_t position = m_index[slot];
+                erase_slot(slot);
+
+                // move last one to the place of removed one
+                if (const size_t last = m_data.size() - 1; position != last)
+                {
+                    m_index[find_slot_of(last)] = position;
+                    m_data[position]            = std::move(m_data[last]);
+                }
+                m_data.pop_back();
+            }
+        }
+
+        void dispose() const
+        {
+            for (const auto& d : m_data)
+            {
+                d.dispose();
+            }
+        }
+
+        void clear()
+        {
+            m_data.clear();
+            m_index.clear();
+        }
+
+    private:
+        size_t home_slot(const void* key) const
+        {
+            // fibonacci hashing: high bits of product are well mixed even for aligned addresses
+            return static_cast<size_t>((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) * 0x9E3779B97F4A7C15ULL) >> (64 - m_index_bits));
+        }
+
+        size_t next_slot(size_t slot) const { return (slot + 1) & (m_index.size() - 1); }
+
+        void rebuild_index()
+        {
+            const size_t capacity = std::bit_ceil(m_data.size() * 4);
+            m_index_bits          = static_cast<size_t>(std::countr_zero(capacity));
+            m_index.assign(capacity, empty_slot);
+            for (size_t i = 0; i < m_data.size(); ++i)
+                insert_to_index(i);
+        }
+
+        void insert_to_index(size_t position)
+        {
+            size_t slot = home_slot(m_data[position].get_id());
+            while (m_index[slot] != empty_slot)
+                slot = next_slot(slot);
+            m_index[slot] = position;
+        }
+
+        size_t find_slot(const void* key) const
+        {
+            for (size_t slot = home_slot(key); m_index[slot] != empty_slot; slot = next_slot(slot))
+            {
+                if (m_data[m_index[slot]].get_id() == key)
+                    return slot;
+            }
+            return empty_slot;
+        }
+
+        size_t find_slot_of(size_t position) const
+        {
+            size_t slot = home_slot(m_data[position].get_id());
+            while (m_index[slot] != position)
+                slot = next_slot(slot);
+            return slot;
+        }
+
+        // backward shift deletion keeps probe sequences unbroken without tombstones
+        void erase_slot(size_t slot)
+        {
+            for (size_t next = next_slot(slot); m_index[next] != empty_slot; next = next_slot(next))
+            {
+                const size_t home = home_slot(m_data[m_index[next]].get_id());
+                // element can't be moved to `slot` if its home slot is cyclically inside (slot, next]
+                if (slot <= next ? (slot < home && home <= next) : (slot < home || home <= next))
+                    continue;
+
+                m_index[slot] = m_index[next];
+                slot          = next;
+            }
+            m_index[slot] = empty_slot;
+        }
+
+    private:
+        std::vector<rpp::disposable_wrapper> m_data{};
+        std::vector<size_t>                  m_index{};
+        size_t                               m_index_bits{};
+    };
+
     template<size_t Count>
     class static_disposables_container
     {
@@ -14,18 +14,141 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/interface_disposable.hpp>
+#include <rpp/memory_model.hpp>
+#include <rpp/utils/thread_local_pool.hpp>
 #include <rpp/utils/utils.hpp>
 
-#include <memory>
-#include <variant>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if defined(__has_include)
+    #if __has_include(<sys/single_threaded.h>)
+        #include <sys/single_threaded.h>
+        #define RPP_HAS_LIBC_SINGLE_THREADED 1
+    #endif
+#endif
 
 namespace rpp::details
 {
     template<rpp::constraint::decayed_type TDisposable>
     class enable_wrapper_from_this;
 
+    /**
+     * @brief Intrusive header of disposable created via `rpp::disposable_wrapper_impl::make`: keeps strong and weak counters right near disposable in the same allocation.
+     * @details Same scheme as control block of `std::make_shared`: disposable is destroyed when last strong reference is released, memory is freed when last weak reference is released. All strong references together hold one weak reference.
+     */
+    class disposable_block
+    {
+    public:
+        disposable_block(const disposable_block&)     = delete;
+        disposable_block(disposable_block&&) noexcept = delete;
+
+        interface_disposable* get() const noexcept { return m_disposable; }
+
+        size_t use_count() const noexcept { return m_strong.load(std::memory_order::relaxed); }
+
+        void add_ref() noexcept { increment(m_strong); }
+
+        /**
+         * @brief Adds strong reference only if disposable is still alive (same as `std::weak_ptr::lock`)
+         */
+        bool try_add_ref() noexcept
+        {
+            auto current = m_strong.load(std::memory_order::relaxed);
+            if (is_single_threaded())
+            {
+                if (current == 0)
+                    return false;
+                m_strong.store(current + 1, std::memory_order::relaxed);
+                return true;
+            }
+
+            while (current != 0)
+            {
+                if (m_strong.compare_exchange_weak(current, current + 1, std::memory_order::acquire, std::memory_order::relaxed))
+                    return true;
+            }
+            return false;
+        }
+
+        void release() noexcept
+        {
+            if (decrement(m_strong) == 1)
+            {
+                destroy_disposable();
+                release_weak();
+            }
+        }
+
+        void add_weak_ref() noexcept { increment(m_weak); }
+
+        void release_weak() noexcept
+        {
+            if (decrement(m_weak) == 1)
+                free_block();
+        }
+
+    protected:
+        disposable_block() = default;
+
+        virtual ~disposable_block() noexcept = default;
+
+        virtual void destroy_disposable() noexcept = 0;
+
+        // destroys block itself and returns its memory to place it was allocated from
+        virtual void free_block() noexcept = 0;
+
+    protected:
+        interface_disposable* m_disposable{};
+
+    private:
+        // same trick as libstdc++ does for shared_ptr: no need in atomic RMW while process has only one thread. Flag becomes false before start of second thread.
+        static bool is_single_threaded() noexcept
+        {
+#if defined(RPP_SINGLE_THREADED)
+            return true;
+#elif defined(RPP_HAS_LIBC_SINGLE_THREADED)
+            return __libc_single_threaded;
+#else
+            return false;
+#endif
+        }
+
+        static void increment(std::atomic<size_t>& counter) noexcept
+        {
+            if (is_single_threaded())
+                counter.store(counter.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+            else
+                counter.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        static size_t decrement(std::atomic<size_t>& counter) noexcept
+        {
+            if (!is_single_threaded())
+                return counter.fetch_sub(1, std::memory_order::acq_rel);
+
+            const auto value = counter.load(std::memory_order::relaxed);
+            counter.store(value - 1, std::memory_order::relaxed);
+            return value;
+        }
+
+    private:
+        std::atomic<size_t> m_strong{1};
+        std::atomic<size_t> m_weak{1};
+    };
+
+    /**
+     * @brief Pool of memory blocks for frequently created short-living disposables (like references of `rpp::refcount_disposable`). See `rpp::utils::thread_local_pool` for details.
+     */
+    using disposables_pool = rpp::utils::thread_local_pool<struct disposables_pool_tag, 32, 8>;
+
+    template<rpp::constraint::decayed_type TDisposable>
+    class arena_dispose_wrapper;
+
     template<rpp::constraint::decayed_type TDisposable>
-    class auto_dispose_wrapper final
+    class auto_dispose_wrapper : public disposable_block
     {
     public:
         static_assert(std::derived_from<TDisposable, interface_disposable>);
@@ -35,79 +158,358 @@ namespace rpp::details
         explicit auto_dispose_wrapper(TArgs&&... args)
             : m_data{std::forward<TArgs>(args)...}
         {
+            m_disposable = &m_data;
+        }
+
+        /**
+         * @brief Allocates block from arena of active `rpp::memory_model::use_arena` scope or from heap otherwise
+         */
+        template<typename... TArgs>
+        static auto_dispose_wrapper* create(TArgs&&... args)
+        {
+            if (auto* const arena = rpp::details::arena::current())
+                return arena_dispose_wrapper<TDisposable>::create(*arena, std::forward<TArgs>(args)...);
+            return new auto_dispose_wrapper(std::forward<TArgs>(args)...);
         }
 
         auto_dispose_wrapper(const auto_dispose_wrapper&)     = delete;
         auto_dispose_wrapper(auto_dispose_wrapper&&) noexcept = delete;
 
-        ~auto_dispose_wrapper() noexcept
+        // m_data is already destroyed by `destroy_disposable`
+        ~auto_dispose_wrapper() noexcept override {}
+
+        // disposable can request re-using of memory of destroyed ones (for frequently created short-living disposables)
+        static void* operator new(size_t size)
         {
-            static_cast<interface_disposable&>(m_data).dispose_impl(rpp::interface_disposable::Mode::Destroying);
+            if constexpr (is_pooled)
+                return disposables_pool::allocate(size);
+            else
+                return ::operator new(size);
+        }
+
+        static void operator delete(void* ptr, size_t size) noexcept
+        {
+            if constexpr (is_pooled)
+                disposables_pool::deallocate(ptr, size);
+            else
+                ::operator delete(ptr, size);
         }
 
         TDisposable* get() { return &m_data; }
 
     private:
-        RPP_NO_UNIQUE_ADDRESS TDisposable m_data;
+        void destroy_disposable() noexcept override
+        {
+            static_cast<interface_disposable&>(m_data).dispose_impl(rpp::interface_disposable::Mode::Destroying);
+            m_data.~TDisposable();
+        }
+
+        void free_block() noexcept override { delete this; }
+
+    private:
+        static constexpr bool is_pooled = requires { requires TDisposable::is_pooled_disposable; };
+
+        union
+        {
+            TDisposable m_data;
+        };
+    };
+
+    /**
+     * @brief Block allocated from arena of `rpp::memory_model::use_arena`: only such blocks keep pointer to arena to return memory to it
+     */
+    template<rpp::constraint::decayed_type TDisposable>
+    class arena_dispose_wrapper final : public auto_dispose_wrapper<TDisposable>
+    {
+    public:
+        template<typename... TArgs>
+        static arena_dispose_wrapper* create(rpp::details::arena& arena, TArgs&&... args)
+        {
+            void* const memory = arena.allocate(sizeof(arena_dispose_wrapper), alignof(arena_dispose_wrapper));
+            try
+            {
+                return ::new (memory) arena_dispose_wrapper(arena, std::forward<TArgs>(args)...);
+            }
+            catch (...)
+            {
+                arena.release();
+                throw;
+            }
+        }
+
+    private:
+        template<typename... TArgs>
+        explicit arena_dispose_wrapper(rpp::details::arena& arena, TArgs&&... args)
+            : auto_dispose_wrapper<TDisposable>{std::forward<TArgs>(args)...}
+            , m_arena{arena}
+        {
+        }
+
+        void free_block() noexcept override
+        {
+            auto& arena = m_arena;
+            this->~arena_dispose_wrapper();
+            arena.release();
+        }
+
+    private:
+        rpp::details::arena& m_arena;
     };
 
     class disposable_wrapper_base
     {
     public:
+        disposable_wrapper_base(const disposable_wrapper_base& other) noexcept
+            : m_handle{other.m_handle}
+        {
+            add_ref();
+        }
+
+        disposable_wrapper_base(disposable_wrapper_base&& other) noexcept
+            : m_handle{std::exchange(other.m_handle, 0)}
+        {
+        }
+
+        disposable_wrapper_base& operator=(const disposable_wrapper_base& other) noexcept
+        {
+            if (this != &other)
+            {
+                other.add_ref();
+                release();
+                m_handle = other.m_handle;
+            }
+            return *this;
+        }
+
+        disposable_wrapper_base& operator=(disposable_wrapper_base&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_handle = std::exchange(other.m_handle, 0);
+            }
+            return *this;
+        }
+
+        ~disposable_wrapper_base() noexcept { release(); }
+
         bool operator==(const disposable_wrapper_base& other) const
         {
-            return get().first == other.get().first;
+            // wrappers of gone disposables are equal to empty ones
+            return get_block() == other.get_block() || (is_expired() && other.is_expired());
         }
 
         bool is_disposed() const noexcept
         {
-            if (const auto locked = get().first)
-                return locked->is_disposed();
-            return true;
+            if (!is_weak())
+            {
+                const auto block = get_block();
+                return !block || block->get()->is_disposed();
+            }
+
+            const auto block = get_block();
+            if (!block->try_add_ref())
+                return true;
+
+            const auto result = block->get()->is_disposed();
+            block->release();
+            return result;
         }
 
         void dispose() const noexcept
         {
-            if (const auto locked = get().first)
-                locked->dispose();
+            // disposing can release last owner of disposable (even this wrapper), so block is kept alive till end of disposing
+            const auto block = lock_block();
+            if (!block)
+                return;
+
+            block->get()->dispose();
+            block->release();
         }
 
+        /**
+         * @brief Identity of underlying disposable: the same for strong and weak wrappers of the same disposable. Doesn't touch reference counters.
+         */
+        const void* get_id() const noexcept { return get_block(); }
+
     protected:
-        explicit disposable_wrapper_base(std::shared_ptr<interface_disposable>&& disposable)
-            : m_disposable{std::move(disposable)}
+        static constexpr std::uintptr_t s_weak_tag = 1;
+
+        /**
+         * @brief Takes ownership over one reference (strong or weak depending on `is_weak`) to the block
+         */
+        disposable_wrapper_base(disposable_block* block, bool is_weak) noexcept
+            : m_handle{reinterpret_cast<std::uintptr_t>(block) | (is_weak && block ? s_weak_tag : 0)}
         {
         }
 
-        explicit disposable_wrapper_base(std::weak_ptr<interface_disposable>&& disposable)
-            : m_disposable{std::move(disposable)}
+        disposable_wrapper_base() = default;
+
+        disposable_block* get_block() const noexcept { return reinterpret_cast<disposable_block*>(m_handle & ~s_weak_tag); } // NOLINT(performance-no-int-to-ptr)
+
+        bool is_weak() const noexcept { return (m_handle & s_weak_tag) != 0; }
+
+        /**
+         * @brief Returns block with added strong reference or nullptr if disposable is empty or gone
+         */
+        disposable_block* lock_block() const noexcept
         {
+            const auto block = get_block();
+            if (!block)
+                return nullptr;
+
+            if (!is_weak())
+            {
+                block->add_ref();
+                return block;
+            }
+            return block->try_add_ref() ? block : nullptr;
         }
 
-        disposable_wrapper_base() = default;
+        /**
+         * @brief Passes ownership over reference to the block to the caller
+         */
+        disposable_block* release_block() noexcept
+        {
+            const auto block = get_block();
+            m_handle         = 0;
+            return block;
+        }
 
-        std::pair<std::shared_ptr<interface_disposable>, bool> get() const noexcept
+    private:
+        bool is_expired() const noexcept
         {
-            if (const auto ptr_ptr = std::get_if<std::shared_ptr<interface_disposable>>(&m_disposable))
-                return {*ptr_ptr, true};
+            const auto block = get_block();
+            return !block || block->use_count() == 0;
+        }
 
-            if (const auto ptr_ptr = std::get_if<std::weak_ptr<interface_disposable>>(&m_disposable))
-                return {ptr_ptr->lock(), false};
+        void add_ref() const noexcept
+        {
+            if (const auto block = get_block())
+            {
+                if (is_weak())
+                    block->add_weak_ref();
+                else
+                    block->add_ref();
+            }
+        }
 
-            return {nullptr, true};
+        void release() const noexcept
+        {
+            if (const auto block = get_block())
+            {
+                if (is_weak())
+                    block->release_weak();
+                else
+                    block->release();
+            }
         }
 
     private:
-        std::variant<std::monostate, std::shared_ptr<interface_disposable>, std::weak_ptr<interface_disposable>> m_disposable;
+        std::uintptr_t m_handle{};
     };
 
 } // namespace rpp::details
 
 namespace rpp
 {
+    /**
+     * @brief Owning pointer to disposable obtained via `rpp::disposable_wrapper_impl::lock`. Behaves like `std::shared_ptr`, but uses intrusive reference counter of disposable.
+     *
+     * @ingroup disposables
+     */
+    template<rpp::constraint::decayed_type TDisposable>
+    class disposable_ptr
+    {
+    public:
+        template<constraint::decayed_type TTarget>
+        friend class disposable_wrapper_impl;
+
+        template<constraint::decayed_type TTarget>
+        friend class disposable_ptr;
+
+        disposable_ptr() = default;
+
+        disposable_ptr(std::nullptr_t) noexcept {}
+
+        disposable_ptr(const disposable_ptr& other) noexcept
+            : m_ptr{other.m_ptr}
+            , m_block{other.m_block}
+        {
+            if (m_block)
+                m_block->add_ref();
+        }
+
+        disposable_ptr(disposable_ptr&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+            , m_block{std::exchange(other.m_block, nullptr)}
+        {
+        }
+
+        template<constraint::decayed_type TOther>
+            requires (!std::same_as<TOther, TDisposable> && std::convertible_to<TOther*, TDisposable*>)
+        disposable_ptr(const disposable_ptr<TOther>& other) noexcept
+            : m_ptr{other.m_ptr}
+            , m_block{other.m_block}
+        {
+            if (m_block)
+                m_block->add_ref();
+        }
+
+        template<constraint::decayed_type TOther>
+            requires (!std::same_as<TOther, TDisposable> && std::convertible_to<TOther*, TDisposable*>)
+        disposable_ptr(disposable_ptr<TOther>&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+            , m_block{std::exchange(other.m_block, nullptr)}
+        {
+        }
+
+        disposable_ptr& operator=(disposable_ptr other) noexcept
+        {
+            std::swap(m_ptr, other.m_ptr);
+            std::swap(m_block, other.m_block);
+            return *this;
+        }
+
+        ~disposable_ptr() noexcept
+        {
+            if (m_block)
+                m_block->release();
+        }
+
+        TDisposable* get() const noexcept { return m_ptr; }
+        TDisposable& operator*() const noexcept { return *m_ptr; }
+        TDisposable* operator->() const noexcept { return m_ptr; }
+
+        explicit operator bool() const noexcept { return m_ptr != nullptr; }
+
+        size_t use_count() const noexcept { return m_block ? m_block->use_count() : 0; }
+
+        template<constraint::decayed_type TOther>
+        bool operator==(const disposable_ptr<TOther>& other) const noexcept
+        {
+            return m_block == other.m_block;
+        }
+
+        bool operator==(std::nullptr_t) const noexcept { return m_ptr == nullptr; }
+
+    private:
+        // takes ownership over already added strong reference
+        explicit disposable_ptr(details::disposable_block* block) noexcept
+            : m_ptr{block ? static_cast<TDisposable*>(block->get()) : nullptr}
+            , m_block{block}
+        {
+        }
+
+    private:
+        TDisposable*               m_ptr{};
+        details::disposable_block* m_block{};
+    };
+
     /**
      * @brief Wrapper to keep disposable. Any disposable have to be created right from this wrapper with help of `make` function.
-     * @details Member functions is safe to call even if internal disposable is gone. Also  it provides access to "raw" shared_ptr and it can be nullptr in case of disposable empty/ptr gone.
-     * @details Can keep weak_ptr in case of not owning disposable
+     * @details Member functions is safe to call even if internal disposable is gone. Also  it provides access to "raw" pointer and it can be nullptr in case of disposable empty/ptr gone.
+     * @details Can keep weak reference in case of not owning disposable. Wrapper is single tagged pointer to intrusive reference counters allocated together with disposable, so it has size of pointer.
      *
      * @ingroup disposables
      */
@@ -123,6 +525,8 @@ namespace rpp
         template<rpp::constraint::decayed_type TTarget>
         friend class details::enable_wrapper_from_this;
 
+        disposable_wrapper_impl() = default;
+
         bool operator==(const disposable_wrapper_impl&) const = default;
 
         /**
@@ -132,13 +536,12 @@ namespace rpp
             requires (std::constructible_from<TTarget, TArgs && ...>)
         static disposable_wrapper_impl make(TArgs&&... args)
         {
-            const auto ptr      = std::make_shared<details::auto_dispose_wrapper<TTarget>>(std::forward<TArgs>(args)...);
-            auto       base_ptr = std::shared_ptr<TDisposable>{ptr, static_cast<TDisposable*>(ptr->get())};
-            if constexpr (rpp::utils::is_base_of_v<TDisposable, rpp::details::enable_wrapper_from_this>)
+            const auto block = details::auto_dispose_wrapper<TTarget>::create(std::forward<TArgs>(args)...);
+            if constexpr (rpp::utils::is_base_of_v<TTarget, rpp::details::enable_wrapper_from_this>)
             {
-                base_ptr->set_weak_self(std::weak_ptr<interface_disposable>(base_ptr));
+                block->get()->set_block(block);
             }
-            return disposable_wrapper_impl{std::static_pointer_cast<interface_disposable>(std::move(base_ptr))};
+            return disposable_wrapper_impl{block, false};
         }
 
         /**
@@ -181,32 +584,28 @@ namespace rpp
                 locked->clear();
         }
 
-        std::shared_ptr<TDisposable> lock() const noexcept
+        disposable_ptr<TDisposable> lock() const noexcept
         {
-            return std::static_pointer_cast<TDisposable>(get().first);
+            return disposable_ptr<TDisposable>{lock_block()};
         }
 
         disposable_wrapper_impl as_weak() const
         {
-            auto [locked, is_shared] = get();
-            if (is_shared)
-                return disposable_wrapper_impl{std::weak_ptr<interface_disposable>{locked}};
-            return *this;
+            const auto block = get_block();
+            if (!block || is_weak())
+                return *this;
+
+            block->add_weak_ref();
+            return disposable_wrapper_impl{block, true};
         }
 
         template<constraint::decayed_type TTarget>
             requires rpp::constraint::static_pointer_convertible_to<TDisposable, TTarget>
         operator disposable_wrapper_impl<TTarget>() const
         {
-            auto [locked, is_shared] = get();
-            if (!locked)
-                return rpp::disposable_wrapper_impl<TTarget>::empty();
-
-            auto res = disposable_wrapper_impl<TTarget>{std::move(locked)};
-            if (is_shared)
-                return res;
-
-            return res.as_weak();
+            // the same block can be referenced by wrapper of any type, so just share the reference
+            auto copy = *this;
+            return disposable_wrapper_impl<TTarget>{copy.release_block(), is_weak()};
         }
 
     private:
@@ -226,18 +625,18 @@ namespace rpp::details
     protected:
         enable_wrapper_from_this() = default;
 
-        void set_weak_self(std::weak_ptr<interface_disposable> weak)
-        {
-            m_weak = std::move(weak);
-        }
+        // block owns this disposable, so it outlives it and can be kept without any reference
+        void set_block(disposable_block* block) { m_block = block; }
 
     public:
         disposable_wrapper_impl<TStrategy> wrapper_from_this() const
         {
-            return disposable_wrapper_impl<TStrategy>(std::static_pointer_cast<interface_disposable>(m_weak.lock()));
+            if (m_block && m_block->try_add_ref())
+                return disposable_wrapper_impl<TStrategy>{m_block, false};
+            return disposable_wrapper_impl<TStrategy>::empty();
         }
 
     private:
-        std::weak_ptr<interface_disposable> m_weak{};
+        disposable_block* m_block{};
     };
 } // namespace rpp::details
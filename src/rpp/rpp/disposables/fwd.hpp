@@ -14,6 +14,8 @@
 
 namespace rpp::details
 {
+    class disposable_block;
+
     template<rpp::constraint::decayed_type TDisposable>
     class auto_dispose_wrapper;
 } // namespace rpp::details
@@ -26,6 +28,9 @@ namespace rpp
     template<rpp::constraint::decayed_type TDisposable>
     class disposable_wrapper_impl;
 
+    template<rpp::constraint::decayed_type TDisposable>
+    class disposable_ptr;
+
     /**
      * @brief Wrapper to keep "simple" disposable. Specialization of rpp::disposable_wrapper_impl
      *
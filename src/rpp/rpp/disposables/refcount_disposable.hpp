@@ -15,9 +15,11 @@
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/disposables/details/base_disposable.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/utils/utils.hpp>
 
 #include <atomic>
 #include <limits>
+#include <mutex>
 
 namespace rpp::details
 {
@@ -26,6 +28,10 @@ namespace rpp::details
 
 namespace rpp
 {
+    /**
+     * @brief Composite disposable which is disposed when all references obtained via `add_ref` are disposed. Disposing of it disposes all alive references too.
+     * @details References are not kept in container of this disposable: each alive reference is linked into intrusive list of this disposable, so obtaining and disposing of reference doesn't allocate anything except of reference itself. Memory of references is re-used via thread-local free-list.
+     */
     class refcount_disposable : public rpp::details::enable_wrapper_from_this<refcount_disposable>
         , public rpp::composite_disposable
     {
@@ -48,6 +54,7 @@ namespace rpp
         void composite_dispose_impl(interface_disposable::Mode) noexcept override
         {
             m_refcount.store(s_disposed, std::memory_order::seq_cst);
+            dispose_refs();
         }
 
     public:
@@ -57,8 +64,17 @@ namespace rpp
         composite_disposable_wrapper add_ref();
 
     private:
-        std::atomic<size_t>     m_refcount{0};
-        constexpr static size_t s_disposed = std::numeric_limits<size_t>::max();
+        bool link(details::refocunt_disposable_inner& ref);
+        void unlink(details::refocunt_disposable_inner& ref);
+        void unlink_unsafe(details::refocunt_disposable_inner& ref);
+        void dispose_refs();
+
+    private:
+        rpp::utils::atomic<size_t>          m_refcount{0};
+        rpp::utils::mutex                   m_refs_mutex{};
+        details::refocunt_disposable_inner* m_refs_head{};
+        bool                                m_refs_disposed{};
+        constexpr static size_t             s_disposed = std::numeric_limits<size_t>::max();
     };
 } // namespace rpp
 
@@ -68,23 +84,32 @@ namespace rpp::details
         , public rpp::details::enable_wrapper_from_this<refocunt_disposable_inner>
     {
     public:
+        static constexpr bool is_pooled_disposable = true;
+
         refocunt_disposable_inner(disposable_wrapper_impl<refcount_disposable> state)
             : m_state{std::move(state)}
         {
         }
 
-        void composite_dispose_impl(interface_disposable::Mode mode) noexcept override
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
         {
-            if (mode != interface_disposable::Mode::Destroying)
-                m_state.remove(this->wrapper_from_this());
-
             if (const auto locked = m_state.lock())
+            {
+                locked->unlink(*this);
                 locked->release();
+            }
             m_state = disposable_wrapper_impl<refcount_disposable>::empty();
         }
 
     private:
+        friend class rpp::refcount_disposable;
+
         disposable_wrapper_impl<refcount_disposable> m_state;
+
+        // node of intrusive list of alive references of `m_state`, guarded by its mutex
+        refocunt_disposable_inner* m_prev{};
+        refocunt_disposable_inner* m_next{};
+        bool                       m_linked{};
     };
 
 } // namespace rpp::details
@@ -102,10 +127,69 @@ namespace rpp
             // just need atomicity, not guarding anything
             if (m_refcount.compare_exchange_strong(current_value, current_value + 1, std::memory_order::seq_cst))
             {
-                auto inner = composite_disposable_wrapper::make<details::refocunt_disposable_inner>(wrapper_from_this());
-                add(inner.as_weak());
+                auto inner = disposable_wrapper_impl<details::refocunt_disposable_inner>::make(wrapper_from_this());
+                // this one was disposed in the meantime
+                if (!link(*inner.lock()))
+                    inner.dispose();
                 return inner;
             }
         }
     }
+
+    inline bool refcount_disposable::link(details::refocunt_disposable_inner& ref)
+    {
+        std::lock_guard lock{m_refs_mutex};
+        if (m_refs_disposed)
+            return false;
+
+        ref.m_next = m_refs_head;
+        if (m_refs_head)
+            m_refs_head->m_prev = &ref;
+        m_refs_head  = &ref;
+        ref.m_linked = true;
+        return true;
+    }
+
+    inline void refcount_disposable::unlink(details::refocunt_disposable_inner& ref)
+    {
+        std::lock_guard lock{m_refs_mutex};
+        if (ref.m_linked)
+            unlink_unsafe(ref);
+    }
+
+    inline void refcount_disposable::unlink_unsafe(details::refocunt_disposable_inner& ref)
+    {
+        if (ref.m_prev)
+            ref.m_prev->m_next = ref.m_next;
+        else
+            m_refs_head = ref.m_next;
+
+        if (ref.m_next)
+            ref.m_next->m_prev = ref.m_prev;
+
+        ref.m_prev   = nullptr;
+        ref.m_next   = nullptr;
+        ref.m_linked = false;
+    }
+
+    inline void refcount_disposable::dispose_refs()
+    {
+        while (true)
+        {
+            auto ref = disposable_wrapper_impl<details::refocunt_disposable_inner>::empty();
+            {
+                std::lock_guard lock{m_refs_mutex};
+                m_refs_disposed = true;
+                if (!m_refs_head)
+                    return;
+
+                // reference can be under destruction right now and can't be locked: it is fine, it would wait for this lock to unlink itself
+                auto& head = *m_refs_head;
+                unlink_unsafe(head);
+                ref = head.wrapper_from_this();
+            }
+            // dispose outside of lock: reference's dependencies can touch this disposable
+            ref.dispose();
+        }
+    }
 } // namespace rpp
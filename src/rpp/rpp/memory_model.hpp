@@ -10,7 +10,15 @@
 
 #pragma once
 
+#include <rpp/utils/utils.hpp>
+
+#include <algorithm>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
 
 namespace rpp::memory_model
 {
@@ -23,6 +31,215 @@ namespace rpp::memory_model
     struct use_shared
     {
     };
+
+    class use_arena;
+} // namespace rpp::memory_model
+
+namespace rpp::details
+{
+    /**
+     * @brief Contiguous region for states of subscriptions: allocation is just bump of pointer inside of current chunk, nothing is freed till destruction of whole arena.
+     * @details Each allocation holds reference to arena, so memory is freed at once when last state allocated from it is destroyed (and `rpp::memory_model::use_arena` scope is closed). Allocation happens only from thread of scope, release can happen from any thread.
+     */
+    class arena
+    {
+    public:
+        /**
+         * @brief Creates arena with first chunk placed in the same allocation
+         */
+        static arena* create(size_t chunk_size)
+        {
+            return ::new (::operator new(sizeof(arena) + chunk_size)) arena{chunk_size};
+        }
+
+        arena(const arena&) = delete;
+        arena(arena&&)      = delete;
+
+        /**
+         * @brief Arena of active `rpp::memory_model::use_arena` scope of current thread or nullptr
+         */
+        static arena* current() { return s_current; }
+
+        void* allocate(size_t size, size_t alignment)
+        {
+            auto* ptr = align(m_cursor, alignment);
+            if (!ptr || ptr + size > m_end)
+            {
+                add_chunk(size + alignment);
+                ptr = align(m_cursor, alignment);
+            }
+
+            m_cursor = ptr + size;
+            m_refcount.fetch_add(1, std::memory_order::relaxed);
+            return ptr;
+        }
+
+        void release() noexcept
+        {
+            if (m_refcount.fetch_sub(1, std::memory_order::acq_rel) == 1)
+            {
+                this->~arena();
+                ::operator delete(this);
+            }
+        }
+
+    private:
+        friend class rpp::memory_model::use_arena;
+
+        explicit arena(size_t chunk_size)
+            : m_chunk_size{chunk_size}
+            , m_cursor{reinterpret_cast<std::byte*>(this + 1)}
+            , m_end{m_cursor + chunk_size}
+        {
+        }
+
+        ~arena() noexcept
+        {
+            while (m_chunks)
+            {
+                auto* next = m_chunks->next;
+                ::operator delete(m_chunks);
+                m_chunks = next;
+            }
+        }
+
+        static std::byte* align(std::byte* ptr, size_t alignment)
+        {
+            if (!ptr)
+                return nullptr;
+            const auto value = reinterpret_cast<std::uintptr_t>(ptr);
+            return ptr + ((alignment - value % alignment) % alignment);
+        }
+
+        void add_chunk(size_t min_size)
+        {
+            const size_t size  = std::max(m_chunk_size, min_size);
+            auto*        chunk = ::new (::operator new(sizeof(chunk_header) + size)) chunk_header{m_chunks};
+
+            m_chunks = chunk;
+            m_cursor = reinterpret_cast<std::byte*>(chunk + 1);
+            m_end    = m_cursor + size;
+        }
+
+    private:
+        struct chunk_header
+        {
+            chunk_header* next;
+        };
+
+        static inline thread_local arena* s_current{};
+
+        const size_t               m_chunk_size;
+        chunk_header*              m_chunks{};
+        std::byte*                 m_cursor{};
+        std::byte*                 m_end{};
+        rpp::utils::atomic<size_t> m_refcount{1};
+    };
+
+    /**
+     * @brief Standard-compatible allocator over arena of active `rpp::memory_model::use_arena` scope (captured during construction) or global `operator new` if there is no such a scope.
+     * @warning Captured arena is used for all future allocations, so allocator is expected only for one-shot allocations right during creation (like `std::allocate_shared`). Don't use it for containers: they can grow later from other thread or after end of scope.
+     */
+    template<typename T>
+    class arena_allocator
+    {
+    public:
+        using value_type = T;
+
+        arena_allocator() noexcept
+            : m_arena{arena::current()}
+        {
+        }
+
+        template<typename U>
+        arena_allocator(const arena_allocator<U>& other) noexcept
+            : m_arena{other.get_arena()}
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            if (m_arena)
+                return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(T* ptr, size_t n) noexcept
+        {
+            if (m_arena)
+                m_arena->release();
+            else
+                std::allocator<T>{}.deallocate(ptr, n);
+        }
+
+        arena* get_arena() const noexcept { return m_arena; }
+
+        template<typename U>
+        bool operator==(const arena_allocator<U>& other) const noexcept
+        {
+            return m_arena == other.get_arena();
+        }
+
+    private:
+        arena* m_arena;
+    };
+
+    /**
+     * @brief Same as `std::make_shared`, but allocates from arena of active `rpp::memory_model::use_arena` scope if any
+     */
+    template<typename T, typename... Args>
+    std::shared_ptr<T> make_shared_in_arena(Args&&... args)
+    {
+        return std::allocate_shared<T>(arena_allocator<T>{}, std::forward<Args>(args)...);
+    }
+} // namespace rpp::details
+
+namespace rpp::memory_model
+{
+    /**
+     * @brief Scope making all states of subscriptions created on the current thread during its lifetime to be allocated from one arena instead of separate heap allocations.
+     * @details Covers states of operators and subjects (disposables created via `rpp::disposable_wrapper_impl::make`) and type-erased forwarders of `dynamic_observable`/`dynamic_observer`. Memory of arena is freed at once when all such states are destroyed and scope is closed. Scopes can be nested: inner scope replaces outer one till its end.
+     * Only fixed-size states are placed to arena: memory which can grow later (like list of children of composite disposable) is always allocated as usual. States created outside of scope (for example, per emission by `flat_map`, `window` or `group_by` when emission happens on other thread or after scope) are allocated as usual too, so subscription is expected to happen on the thread of scope (schedule emissions via `observe_on` instead of moving whole subscription via `subscribe_on`).
+     *
+     * @warning Arena never re-uses memory of destroyed states, so it is intended for short-living subscriptions (like subscription per request): everything created inside of scope is kept till whole arena is freed.
+     *
+     * @par Example
+     * \code{.cpp}
+     * void handle(const request& r)
+     * {
+     *     const rpp::memory_model::use_arena arena{};
+     *     // subscription happens right here, so states of all operators are placed to arena
+     *     process(r) | rpp::operators::observe_on(pool) | rpp::operators::subscribe([](const response& v) { send(v); });
+     * }
+     * \endcode
+     */
+    class use_arena
+    {
+    public:
+        static constexpr size_t default_chunk_size = 4096;
+
+        /**
+         * @param chunk_size size of each contiguous chunk of arena (bigger states get own chunk)
+         */
+        explicit use_arena(size_t chunk_size = default_chunk_size)
+            : m_arena{rpp::details::arena::create(chunk_size)}
+            , m_previous{std::exchange(rpp::details::arena::s_current, m_arena)}
+        {
+        }
+
+        use_arena(const use_arena&) = delete;
+        use_arena(use_arena&&)      = delete;
+
+        ~use_arena() noexcept
+        {
+            rpp::details::arena::s_current = m_previous;
+            m_arena->release();
+        }
+
+    private:
+        rpp::details::arena* m_arena;
+        rpp::details::arena* m_previous;
+    };
 } // namespace rpp::memory_model
 
 namespace rpp::constraint
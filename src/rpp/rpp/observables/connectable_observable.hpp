@@ -13,7 +13,9 @@
 
 #include <rpp/disposables/refcount_disposable.hpp>
 #include <rpp/observables/observable.hpp>
+#include <rpp/utils/utils.hpp>
 
+#include <memory>
 #include <mutex>
 
 namespace rpp::details
@@ -28,7 +30,7 @@ namespace rpp::details
 
         struct state_t
         {
-            std::mutex                                        mutex{};
+            rpp::utils::mutex                                 mutex{};
             disposable_wrapper_impl<rpp::refcount_disposable> disposable = disposable_wrapper_impl<rpp::refcount_disposable>::empty();
         };
 
@@ -160,7 +162,7 @@ namespace rpp
 
         struct state_t
         {
-            std::mutex                        mutex{};
+            rpp::utils::mutex                 mutex{};
             rpp::composite_disposable_wrapper disposable = composite_disposable_wrapper::empty();
         };
 
@@ -11,6 +11,7 @@
 
 #include <rpp/observables/fwd.hpp>
 
+#include <rpp/memory_model.hpp>
 #include <rpp/observables/observable.hpp>
 #include <rpp/observers/dynamic_observer.hpp>
 
@@ -34,7 +35,7 @@ namespace rpp::details::observables
         template<rpp::constraint::observable_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(observable<Type, Strategy>&& obs)
-            : m_forwarder{std::make_shared<observable<Type, Strategy>>(std::move(obs))}
+            : m_forwarder{rpp::details::make_shared_in_arena<observable<Type, Strategy>>(std::move(obs))}
             , m_vtable{vtable::template create<observable<Type, Strategy>>()}
         {
         }
@@ -42,7 +43,7 @@ namespace rpp::details::observables
         template<rpp::constraint::observable_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(const observable<Type, Strategy>& obs)
-            : m_forwarder{std::make_shared<observable<Type, Strategy>>(obs)}
+            : m_forwarder{rpp::details::make_shared_in_arena<observable<Type, Strategy>>(obs)}
             , m_vtable{vtable::template create<observable<Type, Strategy>>()}
         {
         }
@@ -14,6 +14,7 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/utils/utils.hpp>
 
 #include <atomic>
 
@@ -42,7 +43,7 @@ namespace rpp::details::observers
         }
 
     private:
-        std::atomic_bool m_value{};
+        rpp::utils::atomic<bool> m_value{};
     };
 
     class non_atomic_bool
@@ -12,6 +12,7 @@
 #include <rpp/disposables/fwd.hpp>
 #include <rpp/observers/fwd.hpp>
 
+#include <rpp/memory_model.hpp>
 #include <rpp/observers/observer.hpp>
 
 #include <memory>
@@ -45,7 +46,7 @@ namespace rpp::details::observers
         template<rpp::constraint::observer_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(observer<Type, Strategy>&& obs)
-            : m_forwarder{std::make_shared<observer<Type, Strategy>>(std::move(obs))}
+            : m_forwarder{rpp::details::make_shared_in_arena<observer<Type, Strategy>>(std::move(obs))}
             , m_vtable{vtable::template create<observer<Type, Strategy>>()}
         {
         }
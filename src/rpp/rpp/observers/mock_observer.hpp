@@ -14,6 +14,7 @@
 
 #include <rpp/observers/observer.hpp>
 
+#include <memory>
 #include <vector>
 
 template<typename Type>
@@ -45,7 +45,7 @@ namespace rpp::operators::details
         rpp::utils::pointer_under_lock<TObserver>               get_observer() { return m_observer; }
         rpp::utils::pointer_under_lock<std::queue<TObservable>> get_queue() { return m_queue; }
 
-        std::atomic<ConcatStage>& stage() { return m_stage; }
+        rpp::utils::atomic<ConcatStage>& stage() { return m_stage; }
 
         void drain(rpp::composite_disposable_wrapper refcounted)
         {
@@ -99,25 +99,25 @@ namespace rpp::operators::details
     private:
         rpp::utils::value_with_mutex<TObserver>               m_observer;
         rpp::utils::value_with_mutex<std::queue<TObservable>> m_queue;
-        std::atomic<ConcatStage>                              m_stage{};
+        rpp::utils::atomic<ConcatStage>                       m_stage{};
     };
 
     template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
     struct concat_observer_strategy_base
     {
-        concat_observer_strategy_base(std::shared_ptr<concat_state_t<TObservable, TObserver>> state, rpp::composite_disposable_wrapper refcounted)
+        concat_observer_strategy_base(rpp::disposable_ptr<concat_state_t<TObservable, TObserver>> state, rpp::composite_disposable_wrapper refcounted)
             : state{std::move(state)}
             , refcounted{std::move(refcounted)}
         {
         }
 
-        concat_observer_strategy_base(std::shared_ptr<concat_state_t<TObservable, TObserver>> state)
+        concat_observer_strategy_base(rpp::disposable_ptr<concat_state_t<TObservable, TObserver>> state)
             : concat_observer_strategy_base{state, state->add_ref()}
         {
         }
 
-        std::shared_ptr<concat_state_t<TObservable, TObserver>> state;
-        rpp::composite_disposable_wrapper                       refcounted;
+        rpp::disposable_ptr<concat_state_t<TObservable, TObserver>> state;
+        rpp::composite_disposable_wrapper                           refcounted;
 
         void on_error(const std::exception_ptr& err) const
         {
@@ -185,7 +185,7 @@ namespace rpp::operators::details
 
 
     private:
-        static std::shared_ptr<concat_state_t<TObservable, TObserver>> init_state(TObserver&& observer)
+        static rpp::disposable_ptr<concat_state_t<TObservable, TObserver>> init_state(TObserver&& observer)
         {
             const auto d   = disposable_wrapper_impl<concat_state_t<TObservable, TObserver>>::make(std::move(observer));
             auto       ptr = d.lock();
@@ -24,7 +24,7 @@ namespace rpp::operators::details
     template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
     struct debounce_disposable_wrapper
     {
-        std::shared_ptr<debounce_disposable<Observer, Worker, Container>> disposable{};
+        rpp::disposable_ptr<debounce_disposable<Observer, Worker, Container>> disposable{};
 
         bool is_disposed() const { return disposable->is_disposed(); }
 
@@ -56,7 +56,7 @@ namespace rpp::operators::details
             std::lock_guard lock{m_mutex};
             m_value_to_be_emitted.emplace(std::forward<TT>(v));
             const bool need_to_scheduled        = !m_time_when_value_should_be_emitted.has_value();
-            m_time_when_value_should_be_emitted = m_worker.now() + m_period;
+            m_time_when_value_should_be_emitted = m_worker.current_time() + m_period;
             if (need_to_scheduled)
             {
                 schedule();
@@ -95,7 +95,7 @@ namespace rpp::operators::details
             if (!m_time_when_value_should_be_emitted.has_value() || !m_value_to_be_emitted.has_value())
                 return std::monostate{};
 
-            if (m_time_when_value_should_be_emitted > m_worker.now())
+            if (m_time_when_value_should_be_emitted > m_worker.current_time())
                 return m_time_when_value_should_be_emitted.value();
 
             m_time_when_value_should_be_emitted.reset();
@@ -108,7 +108,7 @@ namespace rpp::operators::details
         RPP_NO_UNIQUE_ADDRESS Worker           m_worker;
         rpp::schedulers::duration              m_period;
 
-        std::mutex                            m_mutex{};
+        rpp::utils::mutex                     m_mutex{};
         std::optional<schedulers::time_point> m_time_when_value_should_be_emitted{};
         std::optional<T>                      m_value_to_be_emitted{};
     };
@@ -118,7 +118,7 @@ namespace rpp::operators::details
     {
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        std::shared_ptr<debounce_disposable<Observer, Worker, Container>> disposable{};
+        rpp::disposable_ptr<debounce_disposable<Observer, Worker, Container>> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -15,6 +15,7 @@
 #include <rpp/defs.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/utils.hpp>
 
 #include <mutex>
 #include <queue>
@@ -56,7 +57,7 @@ namespace rpp::operators::details
         RPP_NO_UNIQUE_ADDRESS Worker worker;
         rpp::schedulers::duration    delay;
 
-        std::mutex              mutex{};
+        rpp::utils::mutex       mutex{};
         std::queue<emission<T>> queue;
         bool                    is_active{};
     };
@@ -64,7 +65,7 @@ namespace rpp::operators::details
     template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
     struct delay_disposable_wrapper
     {
-        std::shared_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
+        rpp::disposable_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
 
         bool is_disposed() const { return disposable->is_disposed(); }
 
@@ -74,7 +75,7 @@ namespace rpp::operators::details
     template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, bool ClearOnError>
     struct delay_observer_strategy
     {
-        std::shared_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
+        rpp::disposable_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -127,7 +128,7 @@ namespace rpp::operators::details
             }
             else
             {
-                const auto tp = disposable->worker.now() + disposable->delay;
+                const auto tp = disposable->worker.current_time() + disposable->delay;
                 disposable->queue.emplace(std::forward<TT>(item), tp);
                 if (!disposable->is_active)
                 {
@@ -138,7 +139,7 @@ namespace rpp::operators::details
             }
         }
 
-        static schedulers::optional_delay_to drain_queue(const std::shared_ptr<delay_disposable<Observer, Worker, Container>>& disposable)
+        static schedulers::optional_delay_to drain_queue(const rpp::disposable_ptr<delay_disposable<Observer, Worker, Container>>& disposable)
         {
             while (true)
             {
@@ -150,7 +151,7 @@ namespace rpp::operators::details
                 }
 
                 auto& top = disposable->queue.front();
-                if (top.time_point > disposable->worker.now())
+                if (top.time_point > disposable->worker.current_time())
                     return schedulers::optional_delay_to{top.time_point};
 
                 auto item = std::move(top.value);
@@ -42,13 +42,13 @@ namespace rpp::operators::details
     private:
         rpp::utils::value_with_mutex<Observer> m_observer_with_mutex{};
 
-        std::atomic_size_t m_on_completed_needed{sizeof...(Args)};
+        rpp::utils::atomic<size_t> m_on_completed_needed{sizeof...(Args)};
     };
 
     template<typename TDisposable>
     struct combining_observer_strategy
     {
-        std::shared_ptr<TDisposable> disposable{};
+        rpp::disposable_ptr<TDisposable> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -116,7 +116,7 @@ namespace rpp::operators::details
         }
 
         template<typename ExpectedValue, rpp::constraint::observer Observer, size_t... I>
-        static void subscribe(const std::shared_ptr<TDisposable<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>& disposable, std::index_sequence<I...>, const TObservables&... observables)
+        static void subscribe(const rpp::disposable_ptr<TDisposable<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>& disposable, std::index_sequence<I...>, const TObservables&... observables)
         {
             (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, TStrategy<I + 1, Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{disposable}));
         }
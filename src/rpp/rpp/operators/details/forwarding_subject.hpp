@@ -28,7 +28,7 @@ namespace rpp::operators::details
         {
             using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-            std::shared_ptr<subjects::details::subject_state<Type, false>> state{};
+            rpp::disposable_ptr<subjects::details::subject_state<Type, false>> state{};
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
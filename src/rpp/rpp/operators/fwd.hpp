@@ -176,6 +176,9 @@ namespace rpp::operators
     template<rpp::schedulers::constraint::scheduler Scheduler = rpp::schedulers::immediate>
     auto throttle(rpp::schedulers::duration period);
 
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto throttle(rpp::schedulers::duration period, const Scheduler& scheduler);
+
     template<typename Selector>
         requires rpp::constraint::observable<std::invoke_result_t<Selector, std::exception_ptr>>
     auto on_error_resume_next(Selector&& selector);
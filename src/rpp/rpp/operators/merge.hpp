@@ -42,18 +42,18 @@ namespace rpp::operators::details
 
     private:
         rpp::utils::value_with_mutex<TObserver> m_observer{};
-        std::atomic_size_t                      m_on_completed_needed{1};
+        rpp::utils::atomic<size_t>              m_on_completed_needed{1};
     };
 
     template<rpp::constraint::observer TObserver>
     struct merge_observer_base_strategy
     {
-        merge_observer_base_strategy(std::shared_ptr<merge_disposable<TObserver>>&& disposable)
+        merge_observer_base_strategy(rpp::disposable_ptr<merge_disposable<TObserver>>&& disposable)
             : m_disposable{std::move(disposable)}
         {
         }
 
-        merge_observer_base_strategy(const std::shared_ptr<merge_disposable<TObserver>>& disposable)
+        merge_observer_base_strategy(const rpp::disposable_ptr<merge_disposable<TObserver>>& disposable)
             : m_disposable{disposable}
         {
         }
@@ -89,8 +89,8 @@ namespace rpp::operators::details
         }
 
     protected:
-        std::shared_ptr<merge_disposable<TObserver>> m_disposable;
-        mutable std::vector<rpp::disposable_wrapper> m_disposables{};
+        rpp::disposable_ptr<merge_disposable<TObserver>> m_disposable;
+        mutable std::vector<rpp::disposable_wrapper>     m_disposables{};
     };
 
     template<rpp::constraint::observer TObserver>
@@ -122,7 +122,7 @@ namespace rpp::operators::details
         }
 
     private:
-        static std::shared_ptr<merge_disposable<TObserver>> init_state(TObserver&& observer)
+        static rpp::disposable_ptr<merge_disposable<TObserver>> init_state(TObserver&& observer)
         {
             const auto d   = disposable_wrapper_impl<merge_disposable<TObserver>>::make(std::move(observer));
             auto       ptr = d.lock();
@@ -44,7 +44,7 @@ namespace rpp::operators::details
     {
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        std::shared_ptr<take_until_disposable<TObserver>> state;
+        rpp::disposable_ptr<take_until_disposable<TObserver>> state;
 
         void on_error(const std::exception_ptr& err) const
         {
@@ -22,38 +22,48 @@
 namespace rpp::operators::details
 {
     template<rpp::constraint::observer TObserver, rpp::schedulers::constraint::scheduler Scheduler>
-    struct throttle_observer_strategy
+    class throttle_observer_strategy
     {
+    public:
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        RPP_NO_UNIQUE_ADDRESS TObserver                    observer;
-        rpp::schedulers::duration                          duration{};
-        mutable std::optional<rpp::schedulers::time_point> last_emission_time_point{};
+        throttle_observer_strategy(TObserver&& observer, rpp::schedulers::duration duration, const Scheduler& scheduler)
+            : m_observer{std::move(observer)}
+            , m_duration{duration}
+            , m_worker{scheduler.create_worker()}
+        {
+        }
 
         template<typename T>
         void on_next(T&& v) const
         {
-            const auto now = rpp::schedulers::utils::get_worker_t<Scheduler>::now();
-            if (!last_emission_time_point || now >= last_emission_time_point.value() + duration)
+            const auto now = m_worker.current_time();
+            if (!m_last_emission_time_point || now >= m_last_emission_time_point.value() + m_duration)
             {
-                observer.on_next(std::forward<T>(v));
-                last_emission_time_point = now;
+                m_observer.on_next(std::forward<T>(v));
+                m_last_emission_time_point = now;
             }
         }
 
-        void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
+        void on_error(const std::exception_ptr& err) const { m_observer.on_error(err); }
+
+        void on_completed() const { m_observer.on_completed(); }
 
-        void on_completed() const { observer.on_completed(); }
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
 
-        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
+        bool is_disposed() const { return m_observer.is_disposed(); }
 
-        bool is_disposed() const { return observer.is_disposed(); }
+    private:
+        RPP_NO_UNIQUE_ADDRESS TObserver                                       m_observer;
+        rpp::schedulers::duration                                             m_duration;
+        RPP_NO_UNIQUE_ADDRESS rpp::schedulers::utils::get_worker_t<Scheduler> m_worker;
+        mutable std::optional<rpp::schedulers::time_point>                    m_last_emission_time_point{};
     };
 
     template<rpp::schedulers::constraint::scheduler Scheduler>
-    struct throttle_t : lift_operator<throttle_t<Scheduler>, rpp::schedulers::duration>
+    struct throttle_t : lift_operator<throttle_t<Scheduler>, rpp::schedulers::duration, Scheduler>
     {
-        using lift_operator<throttle_t<Scheduler>, rpp::schedulers::duration>::lift_operator;
+        using lift_operator<throttle_t<Scheduler>, rpp::schedulers::duration, Scheduler>::lift_operator;
 
         template<rpp::constraint::decayed_type T>
         struct operator_traits
@@ -88,7 +98,7 @@ namespace rpp::operators
     * - Obtaining "now" every emission
     *
     * @param period is period of time to skip subsequent emissions
-    * @tparam Scheduler is type used to determine `now()`. Shouldn't be used in production code
+    * @tparam Scheduler is type of scheduler used to determine current time. Default-constructed scheduler of this type is used. Shouldn't be used in production code
     *
     * @warning #include <rpp/operators/throttle.hpp>
     *
@@ -101,6 +111,24 @@ namespace rpp::operators
     template<rpp::schedulers::constraint::scheduler Scheduler /* = rpp::schedulers::immediate*/>
     auto throttle(rpp::schedulers::duration period)
     {
-        return details::throttle_t<std::decay_t<Scheduler>>{period};
+        return details::throttle_t<std::decay_t<Scheduler>>{period, std::decay_t<Scheduler>{}};
+    }
+
+    /**
+    * @brief Emit emission from an Observable and then ignore subsequent values during `duration` of time.
+    * @details Same as `rpp::operators::throttle(rpp::schedulers::duration)`, but current time is obtained from worker of provided scheduler (for example, instance of `rpp::schedulers::virtual_time`)
+    *
+    * @param period is period of time to skip subsequent emissions
+    * @param scheduler is scheduler used to determine current time
+    *
+    * @warning #include <rpp/operators/throttle.hpp>
+    *
+    * @ingroup filtering_operators
+    * @see https://reactivex.io/documentation/operators/debounce.html
+    */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto throttle(rpp::schedulers::duration period, const Scheduler& scheduler)
+    {
+        return details::throttle_t<Scheduler>{period, scheduler};
     }
 } // namespace rpp::operators
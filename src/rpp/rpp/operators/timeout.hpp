@@ -19,7 +19,7 @@
 
 namespace rpp::operators::details
 {
-    template<rpp::constraint::observer TObserver, rpp::constraint::observable TFallbackObservable, rpp::details::disposables::constraint::disposable_container Container>
+    template<rpp::constraint::observer TObserver, rpp::constraint::observable TFallbackObservable, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
     class timeout_disposable final : public rpp::composite_disposable_impl<Container>
     {
     public:
@@ -29,11 +29,17 @@ namespace rpp::operators::details
             rpp::schedulers::time_point timeout;
         };
 
-        timeout_disposable(TObserver&& observer, rpp::schedulers::duration period, const TFallbackObservable& fallback, rpp::schedulers::time_point timeout)
+        timeout_disposable(TObserver&& observer, Worker&& worker, rpp::schedulers::duration period, const TFallbackObservable& fallback, rpp::schedulers::time_point timeout)
             : m_observer_with_timeout{observer_with_timeout{std::move(observer), timeout}}
+            , m_worker{std::move(worker)}
             , m_period{period}
             , m_fallback{fallback}
         {
+            if constexpr (!Worker::is_none_disposable)
+            {
+                if (auto d = m_worker.get_disposable(); !d.is_disposed())
+                    rpp::composite_disposable_impl<Container>::add(std::move(d));
+            }
         }
         rpp::utils::pointer_under_lock<observer_with_timeout> get_observer_with_timeout_under_lock() { return m_observer_with_timeout; }
 
@@ -41,17 +47,20 @@ namespace rpp::operators::details
 
         rpp::schedulers::duration get_period() const { return m_period; }
 
+        const Worker& get_worker() const { return m_worker; }
+
     private:
         rpp::utils::value_with_mutex<observer_with_timeout> m_observer_with_timeout;
 
-        const rpp::schedulers::duration m_period;
-        const TFallbackObservable       m_fallback;
+        RPP_NO_UNIQUE_ADDRESS const Worker m_worker;
+        const rpp::schedulers::duration    m_period;
+        const TFallbackObservable          m_fallback;
     };
 
-    template<rpp::constraint::observer TObserver, rpp::constraint::observable TFallbackObservable, rpp::details::disposables::constraint::disposable_container Container>
+    template<rpp::constraint::observer TObserver, rpp::constraint::observable TFallbackObservable, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
     struct timeout_disposable_wrapper
     {
-        std::shared_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
+        rpp::disposable_ptr<timeout_disposable<TObserver, TFallbackObservable, Worker, Container>> disposable;
 
         bool is_disposed() const { return disposable->is_disposed(); }
 
@@ -62,12 +71,12 @@ namespace rpp::operators::details
         }
     };
 
-    template<rpp::constraint::observer TObserver, rpp::constraint::observable TFallbackObservable, rpp::details::disposables::constraint::disposable_container Container, rpp::schedulers::constraint::scheduler TScheduler>
+    template<rpp::constraint::observer TObserver, rpp::constraint::observable TFallbackObservable, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
     struct timeout_observer_strategy
     {
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        std::shared_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
+        rpp::disposable_ptr<timeout_disposable<TObserver, TFallbackObservable, Worker, Container>> disposable;
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -84,7 +93,7 @@ namespace rpp::operators::details
         {
             auto obs_with_timeout = disposable->get_observer_with_timeout_under_lock();
             obs_with_timeout->observer.on_next(std::forward<T>(v));
-            obs_with_timeout->timeout = rpp::schedulers::utils::get_worker_t<TScheduler>::now() + disposable->get_period();
+            obs_with_timeout->timeout = disposable->get_worker().current_time() + disposable->get_period();
         }
 
         void on_error(const std::exception_ptr& err) const noexcept
@@ -131,25 +140,19 @@ namespace rpp::operators::details
             using worker_t  = rpp::schedulers::utils::get_worker_t<TScheduler>;
             using container = typename DisposableStrategy::template add<worker_t::is_none_disposable ? 0 : 1>::disposable_container;
 
-            const auto timeout = rpp::schedulers::utils::get_worker_t<TScheduler>::now() + period;
+            auto       worker  = scheduler.create_worker();
+            const auto timeout = worker.current_time() + period;
 
-            const auto disposable = disposable_wrapper_impl<timeout_disposable<std::decay_t<Observer>, TFallbackObservable, container>>::make(std::forward<Observer>(observer), period, fallback, timeout);
+            const auto disposable = disposable_wrapper_impl<timeout_disposable<std::decay_t<Observer>, TFallbackObservable, worker_t, container>>::make(std::forward<Observer>(observer), std::move(worker), period, fallback, timeout);
             auto       ptr        = disposable.lock();
             ptr->get_observer_with_timeout_under_lock()->observer.set_upstream(disposable.as_weak());
 
-            const auto worker = scheduler.create_worker();
-            if constexpr (!rpp::schedulers::utils::get_worker_t<TScheduler>::is_none_disposable)
-            {
-                if (auto d = worker.get_disposable(); !d.is_disposed())
-                    disposable.add(std::move(d));
-            }
-
-            using wrapper = timeout_disposable_wrapper<std::decay_t<Observer>, TFallbackObservable, container>;
-            worker.schedule(
+            using wrapper = timeout_disposable_wrapper<std::decay_t<Observer>, TFallbackObservable, worker_t, container>;
+            ptr->get_worker().schedule(
                 timeout,
                 [](wrapper& handler) -> rpp::schedulers::optional_delay_to {
                     auto locked_obs_with_timeout = handler.disposable->get_observer_with_timeout_under_lock();
-                    if (rpp::schedulers::utils::get_worker_t<TScheduler>::now() < locked_obs_with_timeout->timeout)
+                    if (handler.disposable->get_worker().current_time() < locked_obs_with_timeout->timeout)
                         return rpp::schedulers::delay_to(locked_obs_with_timeout->timeout);
 
                     if (!handler.disposable->is_disposed())
@@ -161,7 +164,7 @@ namespace rpp::operators::details
                 },
                 wrapper{ptr});
 
-            return rpp::observer<Type, timeout_observer_strategy<std::decay_t<Observer>, TFallbackObservable, container, TScheduler>>{std::move(ptr)};
+            return rpp::observer<Type, timeout_observer_strategy<std::decay_t<Observer>, TFallbackObservable, worker_t, container>>{std::move(ptr)};
         }
     };
 
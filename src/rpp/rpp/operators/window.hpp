@@ -88,8 +88,8 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_disposable->is_disposed(); }
 
     private:
-        std::shared_ptr<refcount_disposable> m_disposable = disposable_wrapper_impl<refcount_disposable>::make().lock();
-        RPP_NO_UNIQUE_ADDRESS TObserver      m_observer;
+        rpp::disposable_ptr<refcount_disposable> m_disposable = disposable_wrapper_impl<refcount_disposable>::make().lock();
+        RPP_NO_UNIQUE_ADDRESS TObserver          m_observer;
 
         struct subject_data
         {
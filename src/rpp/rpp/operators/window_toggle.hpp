@@ -14,12 +14,14 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/refcount_disposable.hpp>
+#include <rpp/memory_model.hpp>
 #include <rpp/operators/details/forwarding_subject.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/utils/utils.hpp>
 
 #include <list>
+#include <memory>
 
 namespace rpp
 {
@@ -76,7 +78,7 @@ namespace rpp::operators::details
     {
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        std::shared_ptr<rpp::refcount_disposable>                                                 disposable;
+        rpp::disposable_ptr<rpp::refcount_disposable>                                             disposable;
         std::shared_ptr<TState>                                                                   state;
         rpp::composite_disposable_wrapper                                                         this_disposable;
         decltype(std::declval<TState>().on_new_subject(std::declval<typename TState::Subject>())) itr;
@@ -112,8 +114,8 @@ namespace rpp::operators::details
     template<rpp::constraint::decayed_type TState>
     struct window_toggle_opening_observer_strategy
     {
-        std::shared_ptr<rpp::refcount_disposable> disposable;
-        std::shared_ptr<TState>                   state;
+        rpp::disposable_ptr<rpp::refcount_disposable> disposable;
+        std::shared_ptr<TState>                       state;
 
         template<typename T>
         void on_next(T&& v) const
@@ -148,7 +150,7 @@ namespace rpp::operators::details
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
         window_toggle_observer_strategy(TObserver&& observer, const TOpeningsObservable& openings, const TClosingsSelectorFn& closings)
-            : m_state{std::make_shared<TState>(std::move(observer), closings)}
+            : m_state{rpp::details::make_shared_in_arena<TState>(std::move(observer), closings)}
         {
             m_state->get_state_under_lock()->observer.set_upstream(m_disposable->add_ref());
             m_disposable->add(openings.subscribe_with_disposable(window_toggle_opening_observer_strategy<TState>{m_disposable, m_state}));
@@ -182,8 +184,8 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_disposable->is_disposed(); }
 
     private:
-        std::shared_ptr<rpp::refcount_disposable> m_disposable = disposable_wrapper_impl<rpp::refcount_disposable>::make().lock();
-        std::shared_ptr<TState>                   m_state;
+        rpp::disposable_ptr<rpp::refcount_disposable> m_disposable = disposable_wrapper_impl<rpp::refcount_disposable>::make().lock();
+        std::shared_ptr<TState>                       m_state;
     };
 
     template<rpp::constraint::observable TOpeningsObservable, typename TClosingsSelectorFn>
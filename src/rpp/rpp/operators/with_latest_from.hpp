@@ -47,7 +47,7 @@ namespace rpp::operators::details
     template<size_t I, rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... RestArgs>
     struct with_latest_from_inner_observer_strategy
     {
-        std::shared_ptr<with_latest_from_disposable<Observer, TSelector, RestArgs...>> disposable{};
+        rpp::disposable_ptr<with_latest_from_disposable<Observer, TSelector, RestArgs...>> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -83,7 +83,7 @@ namespace rpp::operators::details
         using Result                        = std::invoke_result_t<TSelector, OriginalValue, RestArgs...>;
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        std::shared_ptr<Disposable> disposable{};
+        rpp::disposable_ptr<Disposable> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -163,7 +163,7 @@ namespace rpp::operators::details
         }
 
         template<rpp::constraint::observer Observer, size_t... I>
-        static void subscribe(const std::shared_ptr<with_latest_from_disposable<Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>>& disposable, std::index_sequence<I...>, const TObservables&... observables)
+        static void subscribe(const rpp::disposable_ptr<with_latest_from_disposable<Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>>& disposable, std::index_sequence<I...>, const TObservables&... observables)
         {
             (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, with_latest_from_inner_observer_strategy<I, Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>>{disposable}));
         }
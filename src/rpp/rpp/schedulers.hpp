@@ -17,9 +17,26 @@
  * @ingroup rpp
  */
 
-#include <rpp/schedulers/computational.hpp>
+#include <rpp/schedulers/clocks.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/idle_strategy.hpp>
 #include <rpp/schedulers/immediate.hpp>
-#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/schedulers/instrumented.hpp>
 #include <rpp/schedulers/run_loop.hpp>
-#include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/schedulers/strand.hpp>
+#include <rpp/schedulers/thread_config.hpp>
+#include <rpp/schedulers/time_slice.hpp>
+#include <rpp/schedulers/timer_precision.hpp>
+#include <rpp/schedulers/virtual_time.hpp>
+#include <rpp/schedulers/with_clock.hpp>
+#include <rpp/schedulers/with_priority.hpp>
+
+// schedulers owning threads
+#if !defined(RPP_SINGLE_THREADED)
+    #include <rpp/schedulers/cached_new_thread.hpp>
+    #include <rpp/schedulers/computational.hpp>
+    #include <rpp/schedulers/elastic.hpp>
+    #include <rpp/schedulers/new_thread.hpp>
+    #include <rpp/schedulers/thread_pool.hpp>
+    #include <rpp/schedulers/work_stealing_pool.hpp>
+#endif
@@ -0,0 +1,57 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#if defined(RPP_SINGLE_THREADED)
+    #error "rpp::schedulers::cached_new_thread owns threads and can't be used with RPP_SINGLE_THREADED"
+#endif
+
+#include <rpp/schedulers/new_thread.hpp>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Same as `rpp::schedulers::new_thread`, but re-uses threads of already disposed workers instead of creating new thread for each `create_worker` call.
+     *
+     * @details Each worker still owns dedicated thread while it is alive. When worker disposed and its thread processed all remaining schedulables, thread is parked in the cache and can be obtained by next `create_worker` call. Parked thread exits if nobody obtained it during `keep_alive` duration.
+     * Useful for operators calling `create_worker` per subscription (`subscribe_on`, `delay`, `debounce`, `timeout` and etc) to avoid creation and joining of the thread for each short-lived subscription.
+     *
+     * @param keep_alive duration parked thread waits for new worker before exit
+     * @param max_idle_threads upper bound of amount of parked threads. Threads of disposed workers exit immediately if cache is full. Doesn't limit amount of alive workers.
+     * @param config configuration applied to each thread once right after its creation (index is sequence number of created thread)
+     *
+     * @warning Expected to use this scheduler as local variable to share same cache between different operators or as static variable. Parked threads exit as soon as all copies of scheduler destroyed.
+     *
+     * @ingroup schedulers
+     */
+    class cached_new_thread final
+    {
+    public:
+        explicit cached_new_thread(duration keep_alive = std::chrono::seconds{60}, size_t max_idle_threads = std::thread::hardware_concurrency(), thread_config config = {})
+            : m_cache{std::make_shared<new_thread::thread_cache>(keep_alive, max_idle_threads, std::move(config))}
+        {
+        }
+
+        rpp::schedulers::worker<new_thread::worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<new_thread::worker_strategy>{*m_cache};
+        }
+
+    private:
+        std::shared_ptr<new_thread::thread_cache> m_cache;
+    };
+} // namespace rpp::schedulers
@@ -0,0 +1,146 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/utils.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__linux__)
+    #include <time.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Default clock of all schedulers: `clock_type::now()`.
+     *
+     * @ingroup schedulers
+     */
+    struct precise_clock
+    {
+        static rpp::schedulers::time_point now() { return details::now(); }
+    };
+
+    /**
+     * @brief Monotonic clock with coarse resolution (usually 1-4ms) but much cheaper than `precise_clock`. Based on `CLOCK_MONOTONIC_COARSE` on Linux, same as `precise_clock` on other platforms.
+     * @warning Lags behind `precise_clock` up to its resolution, so timepoints obtained from this clock can be treated by scheduler as slightly "in the past".
+     *
+     * @ingroup schedulers
+     */
+    struct coarse_clock
+    {
+        static rpp::schedulers::time_point now()
+        {
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+            // std::chrono::steady_clock is CLOCK_MONOTONIC on linux, so both clocks share same epoch
+            timespec ts{};
+            if (clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) == 0)
+                return rpp::schedulers::time_point{std::chrono::duration_cast<clock_type::duration>(std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec})};
+#endif
+            return clock_type::now();
+        }
+    };
+
+    /**
+     * @brief Clock based on CPU's time-stamp counter calibrated against `precise_clock`. Reading of counter is much cheaper than syscall-like call to system clock.
+     * @details Counter frequency is calibrated once per process on first call (takes ~1ms). Each thread re-synchronizes with `precise_clock` every ~100ms to avoid accumulation of calibration error.
+     * Falls back to `precise_clock` on non-x86 platforms.
+     * @warning Expects invariant TSC (constant rate and synchronized between cores), which is true for modern x86 CPUs.
+     *
+     * @ingroup schedulers
+     */
+    class tsc_clock
+    {
+    public:
+        static rpp::schedulers::time_point now()
+        {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+            static const double ns_per_tick = calibrate();
+
+            static thread_local anchor s_anchor{clock_type::now(), read_ticks()};
+
+            const auto ticks = read_ticks();
+            const auto res   = s_anchor.time + std::chrono::nanoseconds{static_cast<int64_t>(static_cast<double>(static_cast<int64_t>(ticks - s_anchor.ticks)) * ns_per_tick)};
+            if (res - s_anchor.time >= resync_period)
+                s_anchor = anchor{std::max(clock_type::now(), res), read_ticks()};
+            return res;
+#else
+            return details::now();
+#endif
+        }
+
+    private:
+        static constexpr auto calibration_period = std::chrono::milliseconds{1};
+        static constexpr auto resync_period      = std::chrono::milliseconds{100};
+
+        struct anchor
+        {
+            rpp::schedulers::time_point time;
+            uint64_t                    ticks;
+        };
+
+        static uint64_t read_ticks()
+        {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+            return __builtin_ia32_rdtsc();
+#else
+            return 0;
+#endif
+        }
+
+        static double calibrate()
+        {
+            const auto start_time  = clock_type::now();
+            const auto start_ticks = read_ticks();
+
+            auto end_time = start_time;
+            while (end_time - start_time < calibration_period)
+                end_time = clock_type::now();
+
+            const auto ticks = read_ticks() - start_ticks;
+            return ticks == 0 ? 0.0 : static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count()) / static_cast<double>(ticks);
+        }
+    };
+
+    /**
+     * @brief Clock returning "now" cached by loop of the scheduler: value is obtained from `precise_clock` on first call and re-used till the scheduler starts execution of next schedulable.
+     * @details As a result, any amount of calls inside one schedulable (for example, emissions of values from source scheduled to this scheduler) costs at most one call to system clock. Outside of scheduler loops behaves exactly as `precise_clock`.
+     * @warning Value is not updated during execution of long-running schedulable.
+     *
+     * @ingroup schedulers
+     */
+    struct cached_clock
+    {
+        static rpp::schedulers::time_point now()
+        {
+            if (!details::s_cached_now.is_inside_loop)
+                return details::now();
+
+            if (!details::s_cached_now.is_valid)
+            {
+                details::now();
+                details::s_cached_now.is_valid = true;
+            }
+            return details::s_last_now_time;
+        }
+    };
+} // namespace rpp::schedulers
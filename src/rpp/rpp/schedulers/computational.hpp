@@ -12,13 +12,22 @@
 
 #include <rpp/schedulers/fwd.hpp>
 
+#if defined(RPP_SINGLE_THREADED)
+    #error "rpp::schedulers::computational owns threads and can't be used with RPP_SINGLE_THREADED"
+#endif
+
+#include <rpp/schedulers/thread_config.hpp>
 #include <rpp/schedulers/thread_pool.hpp>
 
+#include <mutex>
+#include <thread>
+
 namespace rpp::schedulers
 {
     /**
      * @brief Scheduler owning static thread pool of workers and using "some" thread from this pool on `create_worker` call
      * @warning Actually it is static variable to `thread_pool` scheduler
+     * @details Pool is created on first `create_worker` call. Amount of threads, assignment policy and thread configuration can be changed via `computational::configure` before that moment.
      * @note Expected to pass to this scheduler intensive CPU bound tasks with relatevely small duration of execution (to be sure that no any thread with tasks from some other operators would be blocked on that task)
      *
      * @par Examples
@@ -31,8 +40,59 @@ namespace rpp::schedulers
     public:
         static auto create_worker()
         {
-            static thread_pool tp{};
-            return tp.create_worker();
+            return get_pool().create_worker();
+        }
+
+        /**
+         * @brief Creates worker bound to the thread selected by hash of the key. See `thread_pool::create_worker(key)`
+         */
+        template<typename Key>
+        static auto create_worker(const Key& key)
+        {
+            return get_pool().create_worker(key);
+        }
+
+        /**
+         * @brief Configures underlying thread pool. Has effect only if called before first `create_worker` call.
+         * @return true if configuration would be applied, false if pool is already created
+         */
+        static bool configure(size_t threads_count, thread_pool::assignment_policy policy = thread_pool::assignment_policy::round_robin, thread_config config = {})
+        {
+            std::lock_guard lock{get_params().mutex};
+            if (get_params().is_created)
+                return false;
+
+            get_params().threads_count = threads_count;
+            get_params().policy        = policy;
+            get_params().config        = std::move(config);
+            return true;
+        }
+
+    private:
+        struct params
+        {
+            std::mutex                     mutex{};
+            bool                           is_created{};
+            size_t                         threads_count{std::thread::hardware_concurrency()};
+            thread_pool::assignment_policy policy{thread_pool::assignment_policy::round_robin};
+            thread_config                  config{};
+        };
+
+        static params& get_params()
+        {
+            static params p{};
+            return p;
+        }
+
+        static const thread_pool& get_pool()
+        {
+            static thread_pool tp = [] {
+                auto&           p = get_params();
+                std::lock_guard lock{p.mutex};
+                p.is_created = true;
+                return thread_pool{p.threads_count, p.policy, p.config};
+            }();
+            return tp;
         }
     };
 } // namespace rpp::schedulers
@@ -99,6 +99,7 @@ namespace rpp::schedulers
 
         static void drain_queue() noexcept
         {
+            const details::cached_now_loop_scope cached_now_scope{};
             while (s_queue && !s_queue->is_empty())
             {
                 auto top = s_queue->pop();
@@ -109,6 +110,7 @@ namespace rpp::schedulers
 
                 while (true)
                 {
+                    details::invalidate_cached_now();
                     if (const auto res = top->make_advanced_call())
                     {
                         if (!top->is_disposed())
@@ -117,7 +119,7 @@ namespace rpp::schedulers
                             {
                                 if (const auto d = std::get_if<delay_from_now>(&res->get()))
                                 {
-                                    std::this_thread::sleep_for(d->value);
+                                    details::sleep_for(d->value);
                                 }
                                 else
                                 {
@@ -12,6 +12,7 @@
 #include <rpp/schedulers/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/schedulers/details/schedulables_pool.hpp>
 #include <rpp/schedulers/details/utils.hpp>
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/tuple.hpp>
@@ -19,6 +20,9 @@
 
 #include "rpp/utils/functors.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <exception>
 #include <memory>
@@ -26,6 +30,7 @@
 #include <optional>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace rpp::schedulers::details
 {
@@ -79,16 +84,9 @@ namespace rpp::schedulers::details
 
         void set_timepoint(const time_point& timepoint) { m_time_point = timepoint; }
 
-        const std::shared_ptr<schedulable_base>& get_next() const { return m_next; }
+        rpp::schedulers::priority get_priority() const { return m_priority; }
 
-        void set_next(std::shared_ptr<schedulable_base>&& next) { m_next = std::move(next); }
-
-        void update_next(std::shared_ptr<schedulable_base>&& next)
-        {
-            if (next)
-                next->set_next(std::move(m_next));
-            m_next = std::move(next);
-        }
+        void set_priority(rpp::schedulers::priority priority) { m_priority = priority; }
 
     protected:
         template<typename NowStrategy>
@@ -107,8 +105,12 @@ namespace rpp::schedulers::details
         }
 
     private:
-        std::shared_ptr<schedulable_base> m_next{};
-        time_point                        m_time_point;
+        template<typename NowStrategy>
+        friend class mpsc_schedulables_queue;
+
+        time_point                m_time_point;
+        schedulable_base*         m_next{};
+        rpp::schedulers::priority m_priority{rpp::schedulers::priority::normal};
     };
 
     template<typename NowStrategy, rpp::constraint::decayed_type Fn, rpp::schedulers::constraint::schedulable_handler Handler, rpp::constraint::decayed_type... Args>
@@ -159,6 +161,18 @@ namespace rpp::schedulers::details
 
         bool is_disposed() const noexcept override { return m_args.template get<0>().is_disposed(); }
 
+        static void* operator new(size_t size)
+            requires (alignof(specific_schedulable) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            return schedulables_pool::allocate(size);
+        }
+
+        static void operator delete(void* ptr, size_t size) noexcept
+            requires (alignof(specific_schedulable) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            schedulables_pool::deallocate(ptr, size);
+        }
+
     private:
         RPP_NO_UNIQUE_ADDRESS rpp::utils::tuple<Handler, Args...> m_args;
         RPP_NO_UNIQUE_ADDRESS Fn                                  m_fn;
@@ -191,6 +205,9 @@ namespace rpp::schedulers::details
         Mutex* m_mutex{};
     };
 
+    // schedulable is owned by exactly one queue (or by worker while executing), so no need in shared ownership
+    using schedulable_ptr = std::unique_ptr<schedulable_base>;
+
     struct shared_queue_data
     {
         std::condition_variable_any cv{};
@@ -208,8 +225,9 @@ namespace rpp::schedulers::details
         schedulables_queue& operator=(const schedulables_queue& other)     = delete;
         schedulables_queue& operator=(schedulables_queue&& other) noexcept = default;
 
-        schedulables_queue(std::weak_ptr<shared_queue_data> shared_data)
+        schedulables_queue(std::weak_ptr<shared_queue_data> shared_data, rpp::schedulers::priority priority = rpp::schedulers::priority::normal)
             : m_shared_data{std::move(shared_data)}
+            , m_priority{priority}
         {
         }
 
@@ -218,10 +236,10 @@ namespace rpp::schedulers::details
         {
             using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
 
-            emplace_impl(std::make_shared<schedulable_type>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+            emplace_impl(schedulable_ptr{new schedulable_type(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...)});
         }
 
-        void emplace(const time_point& timepoint, std::shared_ptr<schedulable_base>&& schedulable)
+        void emplace(const time_point& timepoint, schedulable_ptr&& schedulable)
         {
             if (!schedulable)
                 return;
@@ -230,21 +248,47 @@ namespace rpp::schedulers::details
             emplace_impl(std::move(schedulable));
         }
 
-        bool is_empty() const { return !m_head; }
+        bool is_empty() const { return m_heap.empty(); }
 
-        std::shared_ptr<schedulable_base> pop()
+        size_t size() const { return m_heap.size(); }
+
+        schedulable_ptr pop()
         {
-            return std::exchange(m_head, m_head->get_next());
+            std::pop_heap(m_heap.begin(), m_heap.end(), entry_comparator{});
+            auto res = std::move(m_heap.back().schedulable);
+            m_heap.pop_back();
+            return res;
         }
 
-        const std::shared_ptr<schedulable_base>& top() const
+        const schedulable_ptr& top() const
         {
-            return m_head;
+            return m_heap.front().schedulable;
         }
 
     private:
-        void emplace_impl(std::shared_ptr<schedulable_base>&& schedulable)
+        struct entry
+        {
+            time_point      timepoint;
+            size_t          id;
+            schedulable_ptr schedulable;
+        };
+
+        // std heap algorithms keep "max" element at front, so "greater" entry is one with later timepoint. Id keeps FIFO order for equal timepoints
+        struct entry_comparator
+        {
+            bool operator()(const entry& lhs, const entry& rhs) const
+            {
+                if (lhs.timepoint != rhs.timepoint)
+                    return lhs.timepoint > rhs.timepoint;
+                return lhs.id > rhs.id;
+            }
+        };
+
+        void emplace_impl(schedulable_ptr&& schedulable)
         {
+            // destroyed after unlocking of mutex: destructors of captured state can schedule something again
+            std::vector<schedulable_ptr> disposed{};
+
             // needed in case of new_thread and current_thread shares same queue
             const auto                       s = m_shared_data.lock();
             const rpp::utils::finally_action _{[&] {
@@ -255,26 +299,246 @@ namespace rpp::schedulers::details
             optional_mutex<std::recursive_mutex> mutex{s ? &s->mutex : nullptr};
             std::lock_guard                      lock{mutex};
 
-            if (!m_head || schedulable->get_timepoint() < m_head->get_timepoint())
+            schedulable->set_priority(m_priority);
+            const auto timepoint = schedulable->get_timepoint();
+            m_heap.push_back(entry{timepoint, m_next_id++, std::move(schedulable)});
+            std::push_heap(m_heap.begin(), m_heap.end(), entry_comparator{});
+
+            if (m_heap.size() >= m_compaction_threshold)
+                compact(disposed);
+        }
+
+        /**
+         * @brief Removes disposed schedulables from the whole queue instead of waiting till they reach the top.
+         * @details Invoked each time queue doubles its size since last compaction, so cost is amortized O(1) per emplace and amount of disposed schedulables (and captured by them state) is bounded by amount of alive ones.
+         */
+        void compact(std::vector<schedulable_ptr>& disposed)
+        {
+            const auto it = std::partition(m_heap.begin(), m_heap.end(), [](const entry& e) { return !e.schedulable->is_disposed(); });
+            if (it != m_heap.end())
             {
-                schedulable->set_next(std::move(m_head));
-                m_head = std::move(schedulable);
+                disposed.reserve(static_cast<size_t>(std::distance(it, m_heap.end())));
+                std::for_each(it, m_heap.end(), [&disposed](entry& e) { disposed.push_back(std::move(e.schedulable)); });
+                m_heap.erase(it, m_heap.end());
+            }
+            std::make_heap(m_heap.begin(), m_heap.end(), entry_comparator{});
+
+            m_compaction_threshold = std::max(min_compaction_threshold, m_heap.size() * 2);
+        }
+
+    private:
+        static constexpr size_t min_compaction_threshold = 128;
+
+        std::vector<entry, schedulables_pool_allocator<entry>> m_heap{};
+        size_t                                                 m_next_id{};
+        size_t                                                 m_compaction_threshold{min_compaction_threshold};
+        std::weak_ptr<shared_queue_data>                       m_shared_data{};
+        rpp::schedulers::priority                              m_priority{rpp::schedulers::priority::normal};
+    };
+
+    /**
+     * @brief Set of `schedulables_queue` (lanes) per `rpp::schedulers::priority`: ready schedulables of higher priority lane are selected before ready schedulables of lower priority lanes regardless of their timepoints.
+     * @details To avoid starvation lane with ready schedulables is selected anyway after it was skipped in favour of higher priority lanes `max_skips_in_row` times in a row.
+     * Re-scheduled schedulables are returned to the lane of their original priority.
+     */
+    template<typename NowStrategy>
+    class prioritized_schedulables_queue
+    {
+    public:
+        static constexpr size_t max_skips_in_row = 16;
+
+        prioritized_schedulables_queue() = default;
+
+        explicit prioritized_schedulables_queue(const std::weak_ptr<shared_queue_data>& shared_data)
+            : m_lanes{schedulables_queue<NowStrategy>{shared_data, rpp::schedulers::priority::low},
+                      schedulables_queue<NowStrategy>{shared_data, rpp::schedulers::priority::normal},
+                      schedulables_queue<NowStrategy>{shared_data, rpp::schedulers::priority::high}}
+        {
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            get_lane(rpp::schedulers::priority::normal).emplace(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void emplace(const time_point& timepoint, rpp::schedulers::priority priority, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            get_lane(priority).emplace(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        void emplace(const time_point& timepoint, schedulable_ptr&& schedulable)
+        {
+            if (!schedulable)
                 return;
+
+            get_lane(schedulable->get_priority()).emplace(timepoint, std::move(schedulable));
+        }
+
+        schedulables_queue<NowStrategy>& get_lane(rpp::schedulers::priority priority) { return m_lanes[static_cast<size_t>(priority)]; }
+
+        bool is_empty() const
+        {
+            return std::all_of(m_lanes.cbegin(), m_lanes.cend(), [](const auto& lane) { return lane.is_empty(); });
+        }
+
+        size_t size() const
+        {
+            size_t res{};
+            for (const auto& lane : m_lanes)
+                res += lane.size();
+            return res;
+        }
+
+        /**
+         * @brief Any lane except of normal priority one has schedulables
+         */
+        bool has_prioritized() const
+        {
+            return !m_lanes[static_cast<size_t>(rpp::schedulers::priority::low)].is_empty() || !m_lanes[static_cast<size_t>(rpp::schedulers::priority::high)].is_empty();
+        }
+
+        /**
+         * @brief Timepoint of the earliest schedulable among all lanes. Expected to be called for non-empty queue only.
+         */
+        time_point earliest_timepoint() const
+        {
+            auto res = time_point::max();
+            for (const auto& lane : m_lanes)
+            {
+                if (!lane.is_empty())
+                    res = std::min(res, lane.top()->get_timepoint());
+            }
+            return res;
+        }
+
+        bool has_ready(time_point now) const
+        {
+            return std::any_of(m_lanes.cbegin(), m_lanes.cend(), [now](const auto& lane) { return is_ready(lane, now); });
+        }
+
+        /**
+         * @brief Selects lane which top schedulable should be executed next.
+         * @param now timepoint used to detect ready schedulables (disposed ones are treated as ready to be removed)
+         * @param has_ready_normal normal priority has ready schedulables kept outside of this queue (for example, in queue of immediate schedulables)
+         * @return selected lane or nullptr if there is no ready schedulables. Selected normal lane can be empty in case of `has_ready_normal`.
+         */
+        schedulables_queue<NowStrategy>* select_ready(time_point now, bool has_ready_normal = false)
+        {
+            std::array<bool, lanes_count> ready{};
+            std::optional<size_t>         selected{};
+            for (size_t i = lanes_count; i-- > 0;)
+            {
+                ready[i] = is_ready(m_lanes[i], now) || (has_ready_normal && i == static_cast<size_t>(rpp::schedulers::priority::normal));
+                if (ready[i] && !selected)
+                    selected = i;
+            }
+
+            if (!selected)
+            {
+                m_skips_in_row.fill(0);
+                return nullptr;
             }
 
-            schedulable_base* current = m_head.get();
-            while (const auto& next = current->get_next())
+            // the lowest starving lane goes first
+            for (size_t i = 0; i < selected.value(); ++i)
             {
-                if (schedulable->get_timepoint() < next->get_timepoint())
+                if (ready[i] && m_skips_in_row[i] >= max_skips_in_row)
+                {
+                    selected = i;
                     break;
-                current = next.get();
+                }
             }
 
-            current->update_next(std::move(schedulable));
+            for (size_t i = 0; i < lanes_count; ++i)
+                m_skips_in_row[i] = ready[i] && i != selected.value() ? m_skips_in_row[i] + 1 : 0;
+
+            return &m_lanes[selected.value()];
+        }
+
+    private:
+        static bool is_ready(const schedulables_queue<NowStrategy>& lane, time_point now)
+        {
+            return !lane.is_empty() && (lane.top()->get_timepoint() <= now || lane.top()->is_disposed());
+        }
+
+    private:
+        static constexpr size_t lanes_count = static_cast<size_t>(rpp::schedulers::priority::high) + 1;
+
+        std::array<schedulables_queue<NowStrategy>, lanes_count> m_lanes{schedulables_queue<NowStrategy>{{}, rpp::schedulers::priority::low},
+                                                                        schedulables_queue<NowStrategy>{{}, rpp::schedulers::priority::normal},
+                                                                        schedulables_queue<NowStrategy>{{}, rpp::schedulers::priority::high}};
+        std::array<size_t, lanes_count>                          m_skips_in_row{};
+    };
+
+    /**
+     * @brief Lock-free multi-producer single-consumer queue of schedulables in FIFO order.
+     * @details Producers push schedulables to intrusive lock-free stack. Consumer grabs whole stack at once and reverses it to restore FIFO order, so each push/pop is amortized O(1) without any locks.
+     * @warning `emplace`/`size` can be called from any thread, other methods - only from single consumer thread.
+     */
+    template<typename NowStrategy>
+    class mpsc_schedulables_queue
+    {
+    public:
+        mpsc_schedulables_queue() = default;
+
+        mpsc_schedulables_queue(const mpsc_schedulables_queue&) = delete;
+        mpsc_schedulables_queue(mpsc_schedulables_queue&&)      = delete;
+
+        ~mpsc_schedulables_queue() noexcept
+        {
+            grab_pushed();
+            while (m_consumer_head)
+                delete std::exchange(m_consumer_head, m_consumer_head->m_next);
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
+
+            schedulable_base* node = new schedulable_type(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            m_size.fetch_add(1, std::memory_order_relaxed);
+
+            node->m_next = m_producers_head.load(std::memory_order_relaxed);
+            while (!m_producers_head.compare_exchange_weak(node->m_next, node, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        size_t size() const { return m_size.load(std::memory_order_relaxed); }
+
+        bool is_empty() const { return !m_consumer_head && !m_producers_head.load(std::memory_order_seq_cst); }
+
+        const schedulable_base* front()
+        {
+            if (!m_consumer_head)
+                grab_pushed();
+            return m_consumer_head;
+        }
+
+        schedulable_ptr pop()
+        {
+            if (!m_consumer_head)
+                grab_pushed();
+
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            return schedulable_ptr{std::exchange(m_consumer_head, m_consumer_head->m_next)};
+        }
+
+    private:
+        void grab_pushed()
+        {
+            // stack keeps last pushed element first, so reverse it to restore order of pushes
+            schedulable_base* node = m_producers_head.exchange(nullptr, std::memory_order_acquire);
+            while (node)
+                m_consumer_head = std::exchange(node, std::exchange(node->m_next, m_consumer_head));
         }
 
     private:
-        std::shared_ptr<schedulable_base> m_head{};
-        std::weak_ptr<shared_queue_data>  m_shared_data{};
+        std::atomic<schedulable_base*> m_producers_head{};
+        std::atomic_size_t             m_size{};
+        schedulable_base*              m_consumer_head{};
     };
 } // namespace rpp::schedulers::details
@@ -0,0 +1,51 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/utils/thread_local_pool.hpp>
+
+#include <cstddef>
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Pool of memory blocks for schedulables and internal storages of queues. See `rpp::utils::thread_local_pool` for details.
+     */
+    using schedulables_pool = rpp::utils::thread_local_pool<struct schedulables_pool_tag, 64, 8>;
+
+    /**
+     * @brief Standard-compatible allocator over `schedulables_pool` to keep internal storages of queues allocation-free in steady state too
+     */
+    template<typename T>
+    class schedulables_pool_allocator
+    {
+    public:
+        using value_type = T;
+
+        schedulables_pool_allocator() = default;
+
+        template<typename U>
+        schedulables_pool_allocator(const schedulables_pool_allocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(size_t n) { return static_cast<T*>(schedulables_pool::allocate(n * sizeof(T))); }
+
+        void deallocate(T* ptr, size_t n) noexcept { schedulables_pool::deallocate(ptr, n * sizeof(T)); }
+
+        template<typename U>
+        bool operator==(const schedulables_pool_allocator<U>&) const noexcept
+        {
+            return true;
+        }
+    };
+} // namespace rpp::schedulers::details
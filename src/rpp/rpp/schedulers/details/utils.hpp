@@ -11,9 +11,22 @@
 
 #include <rpp/schedulers/fwd.hpp>
 
+#include <chrono>
 #include <exception>
 #include <optional>
 #include <thread>
+#include <utility>
+
+#if defined(__linux__)
+    #include <sys/timerfd.h>
+    #include <unistd.h>
+
+    #include <cstdint>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
 
 namespace rpp::schedulers::details
 {
@@ -24,17 +37,162 @@ namespace rpp::schedulers::details
         return s_last_now_time = clock_type::now();
     }
 
+    /**
+     * @brief State of "now" cached for `rpp::schedulers::cached_clock`. Loops of schedulers mark it as outdated before execution of each schedulable.
+     */
+    struct cached_now_state
+    {
+        bool is_inside_loop{};
+        bool is_valid{};
+    };
+
+    inline thread_local cached_now_state s_cached_now{};
+
+    inline void invalidate_cached_now() { s_cached_now.is_valid = false; }
+
+    /**
+     * @brief Marks current thread as executing loop of scheduler which invalidates cached "now" on each iteration
+     */
+    class cached_now_loop_scope
+    {
+    public:
+        cached_now_loop_scope()
+            : m_prev{std::exchange(s_cached_now, cached_now_state{true, false})}
+        {
+        }
+
+        cached_now_loop_scope(const cached_now_loop_scope&) = delete;
+        cached_now_loop_scope(cached_now_loop_scope&&)      = delete;
+
+        ~cached_now_loop_scope() noexcept { s_cached_now = m_prev; }
+
+    private:
+        cached_now_state m_prev;
+    };
+
+    inline void cpu_relax()
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+#endif
+    }
+
+    /**
+     * @brief Spin window of precise timer of current thread (see `rpp::schedulers::timer_precision`). Nullopt means that OS timers are used as is.
+     */
+    inline thread_local std::optional<duration> s_precise_timer_spin_window{};
+
+#if defined(__linux__)
+    /**
+     * @brief Blocks calling thread till absolute timepoint via per-thread timerfd
+     * @return false if timerfd is not available and caller should fallback to usual sleep
+     */
+    inline bool sleep_on_timerfd(const time_point timepoint)
+    {
+        struct timer_fd
+        {
+            timer_fd() = default;
+            timer_fd(const timer_fd&) = delete;
+            timer_fd(timer_fd&&)      = delete;
+            ~timer_fd() noexcept
+            {
+                if (fd >= 0)
+                    close(fd);
+            }
+
+            int fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+        };
+        static thread_local const timer_fd s_timer{};
+        if (s_timer.fd < 0)
+            return false;
+
+        // std::chrono::steady_clock is CLOCK_MONOTONIC on linux. Zero value disarms timer, so use at least 1ns (anyway it is in the past)
+        const auto ns = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint.time_since_epoch()).count(), std::chrono::nanoseconds::rep{1});
+
+        itimerspec spec{};
+        spec.it_value.tv_sec  = static_cast<time_t>(ns / 1'000'000'000);
+        spec.it_value.tv_nsec = static_cast<long>(ns % 1'000'000'000);
+        if (timerfd_settime(s_timer.fd, TFD_TIMER_ABSTIME, &spec, nullptr) != 0)
+            return false;
+
+        uint64_t expirations{};
+        return read(s_timer.fd, &expirations, sizeof(expirations)) == static_cast<ssize_t>(sizeof(expirations));
+    }
+#endif
+
+    /**
+     * @brief Sleeps till `timepoint - spin_window` via OS timer with absolute deadline and spins rest of time to wake up exactly at timepoint
+     */
+    inline void precise_sleep_until(const time_point timepoint, const duration spin_window)
+    {
+        const auto coarse_deadline = timepoint - spin_window;
+        if (clock_type::now() < coarse_deadline)
+        {
+#if defined(__linux__)
+            if (!sleep_on_timerfd(coarse_deadline))
+#endif
+                std::this_thread::sleep_until(coarse_deadline);
+        }
+
+        while (clock_type::now() < timepoint)
+            cpu_relax();
+    }
+
+    /**
+     * @brief Sleeps for provided duration respecting precise timer of current thread
+     */
+    inline void sleep_for(const duration duration)
+    {
+        if (duration <= duration::zero())
+            return;
+
+        if (s_precise_timer_spin_window)
+            precise_sleep_until(clock_type::now() + duration, s_precise_timer_spin_window.value());
+        else
+            std::this_thread::sleep_for(duration);
+    }
+
     inline bool sleep_until(const time_point timepoint)
     {
         if (timepoint <= details::s_last_now_time)
             return false;
 
         const auto now = clock_type::now();
-        std::this_thread::sleep_for(timepoint - now);
+        details::sleep_for(timepoint - now);
         details::s_last_now_time = std::max(now, timepoint);
         return timepoint > now;
     }
 
+    /**
+     * @brief Waits on condition variable till `pred` returns true or timepoint is reached respecting precise timer of current thread: waits on condition variable till `timepoint - spin_window` and then polls `pred` with released lock till timepoint.
+     * @return result of `pred`
+     */
+    template<typename ConditionVariable, typename Lock, std::predicate Pred>
+    bool wait_until(ConditionVariable& cv, Lock& lock, const time_point timepoint, Pred&& pred)
+    {
+        if (!s_precise_timer_spin_window)
+            return cv.wait_until(lock, timepoint, pred);
+
+        const auto coarse_deadline = timepoint - s_precise_timer_spin_window.value();
+        if (clock_type::now() < coarse_deadline && cv.wait_until(lock, coarse_deadline, pred))
+            return true;
+
+        while (clock_type::now() < timepoint)
+        {
+            if (pred())
+                return true;
+
+            lock.unlock();
+            cpu_relax();
+            lock.lock();
+        }
+        return pred();
+    }
+
     /**
      * @brief Makes immediate-like scheduling for provided arguments
      * @returns nullopt in case of subscription unsubscribed or schedulable doesn't requested to re-schedule, some value - in case of condition failed but still some duration to delay action
@@ -47,6 +205,7 @@ namespace rpp::schedulers::details
                                                                    Args&&... args) noexcept
     {
         auto timepoint = NowStrategy::now() + duration;
+        const cached_now_loop_scope cached_now_scope{};
         while (condition())
         {
             if (handler.is_disposed())
@@ -57,6 +216,7 @@ namespace rpp::schedulers::details
 
             try
             {
+                invalidate_cached_now();
                 if (const auto duration_from_timepoint = fn(handler, args...))
                     timepoint += duration_from_timepoint->value;
                 else
@@ -83,6 +243,7 @@ namespace rpp::schedulers::details
                                                                    Handler&&                                                          handler,
                                                                    Args&&... args) noexcept
     {
+        const cached_now_loop_scope cached_now_scope{};
         while (condition())
         {
             if (handler.is_disposed())
@@ -90,7 +251,7 @@ namespace rpp::schedulers::details
 
             if (duration > duration::zero())
             {
-                std::this_thread::sleep_for(duration);
+                details::sleep_for(duration);
 
                 if (handler.is_disposed())
                     return std::nullopt;
@@ -98,6 +259,7 @@ namespace rpp::schedulers::details
 
             try
             {
+                invalidate_cached_now();
                 if (const auto new_duration = fn(handler, args...))
                     duration = new_duration->value;
                 else
@@ -125,6 +287,7 @@ namespace rpp::schedulers::details
                                                                    Args&&... args) noexcept
     {
         std::optional<time_point> timepoint{};
+        const cached_now_loop_scope cached_now_scope{};
         while (condition())
         {
             if (handler.is_disposed())
@@ -134,7 +297,7 @@ namespace rpp::schedulers::details
             {
                 if (duration > duration::zero())
                 {
-                    std::this_thread::sleep_for(duration);
+                    details::sleep_for(duration);
 
                     if (handler.is_disposed())
                         return std::nullopt;
@@ -145,6 +308,7 @@ namespace rpp::schedulers::details
 
             try
             {
+                invalidate_cached_now();
                 if (const auto new_timepoint = fn(handler, args...))
                     timepoint = new_timepoint->value;
                 else
@@ -44,7 +44,7 @@ namespace rpp::schedulers
             if constexpr (constraint::defer_for_strategy<Strategy>)
                 m_strategy.defer_for(delay, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             else
-                schedule(now() + delay, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                schedule(current_time() + delay, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
         }
 
         template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
@@ -53,7 +53,35 @@ namespace rpp::schedulers
             if constexpr (constraint::defer_to_strategy<Strategy>)
                 m_strategy.defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             else
-                schedule(tp - now(), std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                schedule(tp - current_time(), std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Schedules schedulable with provided priority. Priority is ignored if scheduler doesn't support priorities.
+         * @details See `rpp::schedulers::priority`
+         */
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void schedule(const priority priority, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            schedule(priority, duration{}, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void schedule(const priority priority, const duration delay, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            if constexpr (constraint::prioritized_strategy<Strategy>)
+                m_strategy.defer_to(current_time() + delay, priority, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            else
+                schedule(delay, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void schedule(const priority priority, const time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            if constexpr (constraint::prioritized_strategy<Strategy>)
+                m_strategy.defer_to(tp, priority, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            else
+                schedule(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
         }
 
         rpp::disposable_wrapper get_disposable() const
@@ -66,6 +94,17 @@ namespace rpp::schedulers
 
         static rpp::schedulers::time_point now() { return Strategy::now(); }
 
+        /**
+         * @brief Current time of clock of this worker. Same as `now()` except of schedulers with own clock per instance (like `rpp::schedulers::virtual_time`) where static `now()` can't know time of exact instance.
+         */
+        rpp::schedulers::time_point current_time() const
+        {
+            if constexpr (constraint::instance_clock_strategy<Strategy>)
+                return m_strategy.current_time();
+            else
+                return Strategy::now();
+        }
+
         static constexpr bool is_none_disposable = std::same_as<decltype(std::declval<Strategy>().get_disposable()), rpp::schedulers::details::none_disposable>;
 
     private:
@@ -0,0 +1,299 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#if defined(RPP_SINGLE_THREADED)
+    #error "rpp::schedulers::elastic owns threads and can't be used with RPP_SINGLE_THREADED"
+#endif
+
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/utils.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/schedulers/strand.hpp>
+#include <rpp/schedulers/thread_config.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler owning elastic pool of threads for blocking work (file/network IO, database drivers, `as_blocking` bridges and etc).
+     *
+     * @details Pool starts with `min_threads` threads and creates new thread each time some schedulable is ready while all threads are busy, till `max_threads` threads. After that schedulables are queued till some thread becomes free. Threads above `min_threads` exit after `idle_timeout` without any work.
+     * Each worker is `rpp::schedulers::strand` over this pool: schedulables of the same worker are executed serially and in order of their timepoints, but can be executed by any thread of the pool, so workers don't occupy threads while they have nothing to do (unlike `new_thread` where each worker owns thread).
+     * Optional `thread_config` is applied to each thread of the pool (index is sequence number of created thread). See `rpp::schedulers::thread_config`.
+     *
+     * @par Example
+     * \code{.cpp}
+     * const auto io = rpp::schedulers::elastic{0, 64, std::chrono::seconds{30}};
+     * requests | rpp::operators::flat_map([io](const auto& request) { return rpp::source::just(request) | rpp::operators::subscribe_on(io) | rpp::operators::map(&blocking_query); });
+     * \endcode
+     *
+     * @warning Expected to use this scheduler as local variable to share same threads between different operators or as static variable
+     *
+     * @ingroup schedulers
+     */
+    class elastic final
+    {
+        class shared_state;
+
+        // executes each schedulable independently on any thread of the pool, serialization is provided by `strand`
+        class executor_strategy
+        {
+        public:
+            explicit executor_strategy(std::shared_ptr<shared_state> state)
+                : m_state{std::move(state)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_state->emplace(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
+
+            static rpp::schedulers::time_point now() { return details::now(); }
+
+        private:
+            std::shared_ptr<shared_state> m_state;
+        };
+
+        class shared_state final : public std::enable_shared_from_this<shared_state>
+        {
+            struct idle_thread
+            {
+                std::condition_variable cv{};
+                bool                    is_woken_up{};
+            };
+
+        public:
+            shared_state(size_t min_threads, size_t max_threads, duration idle_timeout, thread_config config)
+                : m_min_threads{min_threads}
+                , m_max_threads{std::max(size_t{1}, std::max(min_threads, max_threads))}
+                , m_idle_timeout{idle_timeout}
+                , m_config{std::move(config)}
+            {
+            }
+
+            void start()
+            {
+                std::lock_guard lock{m_mutex};
+                while (m_threads_count < m_min_threads)
+                    spawn_thread_unsafe();
+            }
+
+            template<typename... Args>
+            void emplace(time_point tp, Args&&... args)
+            {
+                std::unique_lock lock{m_mutex};
+                m_queue.emplace(tp, std::forward<Args>(args)...);
+
+                if (tp <= details::now())
+                {
+                    // each idle thread can take only one schedulable, so grow pool if all of them are already woken up
+                    if (!m_idle_threads.empty())
+                    {
+                        idle_thread* thread = m_idle_threads.back();
+                        m_idle_threads.pop_back();
+                        thread->is_woken_up = true;
+                        // under lock: thread can leave waiting by its own timeout and destroy `idle_thread` right after unlock
+                        thread->cv.notify_one();
+                    }
+                    else if (m_threads_count < m_max_threads)
+                        spawn_thread_unsafe();
+                    return;
+                }
+
+                // somebody has to wait for this timepoint
+                if (m_idle_threads.empty() && m_threads_count < m_max_threads)
+                    spawn_thread_unsafe();
+                // new delayed schedulable is the earliest one: idle thread has to wait for new deadline
+                else if (!m_idle_threads.empty() && m_queue.top()->get_timepoint() == tp)
+                    m_idle_threads.back()->cv.notify_one();
+            }
+
+            void stop()
+            {
+                std::lock_guard lock{m_mutex};
+                m_is_stopped = true;
+                for (idle_thread* thread : m_idle_threads)
+                    thread->cv.notify_one();
+            }
+
+            size_t get_threads_count() const
+            {
+                std::lock_guard lock{m_mutex};
+                return m_threads_count;
+            }
+
+        private:
+            void spawn_thread_unsafe()
+            {
+                ++m_threads_count;
+                std::thread{[state = shared_from_this(), index = m_created_count++] {
+                    state->m_config.apply(index);
+                    state->thread_loop();
+                }}.detach();
+            }
+
+            void thread_loop()
+            {
+                const details::cached_now_loop_scope cached_now_scope{};
+
+                std::unique_lock lock{m_mutex};
+                while (true)
+                {
+                    if (!m_queue.is_empty() && m_queue.top()->get_timepoint() <= details::now())
+                    {
+                        auto top = m_queue.pop();
+                        lock.unlock();
+
+                        if (top->is_disposed())
+                        {
+                            top.reset();
+                            lock.lock();
+                            continue;
+                        }
+
+                        details::invalidate_cached_now();
+                        if (const auto tp = (*top)(); tp && !top->is_disposed())
+                            emplace(tp.value(), std::move(top));
+                        top.reset();
+
+                        lock.lock();
+                        continue;
+                    }
+
+                    if (m_is_stopped && m_queue.is_empty())
+                        break;
+
+                    if (!wait_for_work(lock) && m_threads_count > m_min_threads)
+                        break;
+                }
+                --m_threads_count;
+            }
+
+            /**
+             * @returns false in case of thread was idle during whole idle timeout
+             */
+            bool wait_for_work(std::unique_lock<std::mutex>& lock)
+            {
+                idle_thread self{};
+                m_idle_threads.push_back(&self);
+
+                bool has_work{};
+                if (m_queue.is_empty())
+                {
+                    has_work = self.cv.wait_for(lock, m_idle_timeout, [&] { return self.is_woken_up || !m_queue.is_empty() || m_is_stopped; });
+                }
+                else
+                {
+                    const auto top_timepoint = m_queue.top()->get_timepoint();
+                    details::wait_until(self.cv, lock, top_timepoint, [&] { return self.is_woken_up || m_is_stopped || m_queue.is_empty() || m_queue.top()->get_timepoint() < top_timepoint || top_timepoint <= details::now(); });
+                    has_work = true;
+                }
+
+                // woken up by timeout/timer/other reason: nobody has removed this thread from idle ones
+                if (!self.is_woken_up)
+                    m_idle_threads.erase(std::find(m_idle_threads.begin(), m_idle_threads.end(), &self));
+                return has_work;
+            }
+
+        private:
+            const size_t        m_min_threads;
+            const size_t        m_max_threads;
+            const duration      m_idle_timeout;
+            const thread_config m_config;
+
+            mutable std::mutex                             m_mutex{};
+            details::schedulables_queue<executor_strategy> m_queue{};
+            // waiting threads not woken up for ready schedulable yet: each of them has own condition variable, so exactly one thread is woken up for each ready schedulable
+            std::vector<idle_thread*>                      m_idle_threads{};
+            size_t                                         m_threads_count{};
+            size_t                                         m_created_count{};
+            bool                                           m_is_stopped{};
+        };
+
+        // owner of the pool: threads exit after processing of remaining schedulables when all copies of scheduler and all workers are destroyed
+        class state final
+        {
+        public:
+            state(size_t min_threads, size_t max_threads, duration idle_timeout, thread_config config)
+                : m_shared{std::make_shared<shared_state>(min_threads, max_threads, idle_timeout, std::move(config))}
+            {
+                m_shared->start();
+            }
+
+            state(const state&) = delete;
+            state(state&&)      = delete;
+
+            ~state() noexcept { m_shared->stop(); }
+
+            const std::shared_ptr<shared_state>& get_shared() const { return m_shared; }
+
+        private:
+            std::shared_ptr<shared_state> m_shared;
+        };
+
+        class executor
+        {
+        public:
+            explicit executor(std::shared_ptr<state> state)
+                : m_state{std::move(state)}
+            {
+            }
+
+            rpp::schedulers::worker<executor_strategy> create_worker() const
+            {
+                return rpp::schedulers::worker<executor_strategy>{m_state->get_shared()};
+            }
+
+        private:
+            std::shared_ptr<state> m_state;
+        };
+
+    public:
+        static constexpr size_t default_max_threads = 128;
+
+        /**
+         * @param min_threads amount of threads kept alive even without any work
+         * @param max_threads upper bound of amount of threads, schedulables are queued when all of them are busy
+         * @param idle_timeout duration thread above `min_threads` waits for new work before exit
+         * @param config configuration applied to each thread right after its creation
+         */
+        explicit elastic(size_t min_threads = 0, size_t max_threads = default_max_threads, duration idle_timeout = std::chrono::seconds{60}, thread_config config = {})
+            : m_state{std::make_shared<state>(min_threads, max_threads, idle_timeout, std::move(config))}
+            , m_strands{executor{m_state}}
+        {
+        }
+
+        auto create_worker() const { return m_strands.create_worker(); }
+
+        /**
+         * @brief Amount of alive threads of the pool right now
+         */
+        size_t threads_count() const { return m_state->get_shared()->get_threads_count(); }
+
+    private:
+        std::shared_ptr<state> m_state;
+        strand<executor>       m_strands;
+    };
+} // namespace rpp::schedulers
@@ -15,6 +15,7 @@
 #include <rpp/utils/constraints.hpp>
 
 #include <chrono>
+#include <cstdint>
 #include <optional>
 
 namespace rpp::schedulers
@@ -79,6 +80,18 @@ namespace rpp::schedulers
     using optional_delay_from_now            = std::optional<delay_from_now>;
     using optional_delay_from_this_timepoint = std::optional<delay_from_this_timepoint>;
     using optional_delay_to                  = std::optional<delay_to>;
+
+    /**
+     * @brief Priority of schedulable within worker: ready schedulables of higher priority are executed before ready schedulables of lower priority even if they were scheduled later or to later timepoint.
+     * @details Schedulers supporting priorities keep separate queue per priority and execute lower priority queue after it was skipped in favour of higher ones few times in a row, so low priority schedulables are not starved forever.
+     * Supported by `new_thread`, `cached_new_thread` and `run_loop`, other schedulers ignore priority. See `rpp::schedulers::with_priority` to apply it to all schedulables of some operator.
+     */
+    enum class priority : uint8_t
+    {
+        low,
+        normal,
+        high
+    };
 } // namespace rpp::schedulers
 
 namespace rpp::schedulers::details
@@ -147,6 +160,21 @@ namespace rpp::schedulers::constraint
         } -> std::same_as<void>;
     };
 
+    template<typename S>
+    concept prioritized_strategy = requires(const S& s, const details::fake_schedulable_handler& handler) {
+        {
+            s.defer_to(time_point{}, priority{}, std::declval<optional_delay_from_now (*)(const details::fake_schedulable_handler&)>(), handler)
+        } -> std::same_as<void>;
+    };
+
+    // strategy with own clock per instance (like `rpp::schedulers::virtual_time`): static `now()` can't know time of exact instance
+    template<typename S>
+    concept instance_clock_strategy = requires(const S& s) {
+        {
+            s.current_time()
+        } -> std::same_as<rpp::schedulers::time_point>;
+    };
+
     template<typename S>
     concept strategy = (defer_for_strategy<S> || defer_to_strategy<S>) && requires(const S& s, const details::fake_schedulable_handler& handler) {
         {
@@ -156,6 +184,13 @@ namespace rpp::schedulers::constraint
             S::now()
         } -> std::same_as<rpp::schedulers::time_point>;
     };
+
+    template<typename C>
+    concept clock = requires {
+        {
+            C::now()
+        } -> std::same_as<rpp::schedulers::time_point>;
+    };
 } // namespace rpp::schedulers::constraint
 
 namespace rpp::schedulers
@@ -166,9 +201,25 @@ namespace rpp::schedulers
     class immediate;
     class current_thread;
     class new_thread;
+    class cached_new_thread;
     class run_loop;
     class thread_pool;
     class computational;
+    class work_stealing_pool;
+    class elastic;
+    class virtual_time;
+
+    class idle_strategy;
+    class timer_precision;
+    class time_slice;
+
+    struct precise_clock;
+    struct coarse_clock;
+    class tsc_clock;
+    struct cached_clock;
+
+    class scheduler_metrics;
+    struct thread_config;
 
     namespace defaults
     {
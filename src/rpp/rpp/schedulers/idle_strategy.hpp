@@ -0,0 +1,96 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/utils.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <thread>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Strategy used by thread of scheduler to wait for new schedulables when its queue is empty.
+     * @details By default thread blocks on condition variable, so each handoff of schedulable to idle thread costs wake up of thread by OS (futex + context switch).
+     * Other strategies keep thread awake for some time (or forever) to reduce latency of handoff in exchange of CPU usage. Producer doesn't notify condition variable while thread is spinning.
+     *
+     * - `blocking()` - thread immediately blocks on condition variable (default)
+     * - `busy_spin()` - thread spins without yielding CPU till new schedulable arrives. Lowest latency, but occupies whole core.
+     * - `spin_then_yield(n)` - thread spins `n` iterations and then calls `std::this_thread::yield()` till new schedulable arrives.
+     * - `spin_then_park(n)` - thread spins `n` iterations and then blocks on condition variable as usual.
+     *
+     * @warning Spinning strategies make sense only when amount of spinning threads is less than amount of cores.
+     *
+     * @ingroup schedulers
+     */
+    class idle_strategy
+    {
+        enum class mode
+        {
+            blocking,
+            busy_spin,
+            spin_then_yield,
+            spin_then_park
+        };
+
+    public:
+        static constexpr size_t default_spin_count = 1000;
+
+        constexpr idle_strategy() = default;
+
+        static constexpr idle_strategy blocking() { return idle_strategy{mode::blocking, 0}; }
+        static constexpr idle_strategy busy_spin() { return idle_strategy{mode::busy_spin, 0}; }
+        static constexpr idle_strategy spin_then_yield(size_t spin_count = default_spin_count) { return idle_strategy{mode::spin_then_yield, spin_count}; }
+        static constexpr idle_strategy spin_then_park(size_t spin_count = default_spin_count) { return idle_strategy{mode::spin_then_park, spin_count}; }
+
+        constexpr bool is_blocking() const { return m_mode == mode::blocking; }
+
+        /**
+         * @brief Keeps calling thread awake till `ready` returns true or spin budget exhausted.
+         * @return true if `ready` returned true, false if caller should block on its condition variable as usual
+         */
+        template<std::predicate Ready>
+        bool wait(Ready&& ready) const
+        {
+            if (m_mode == mode::blocking)
+                return false;
+
+            for (size_t i = 0; m_mode == mode::busy_spin || i < m_spin_count; ++i)
+            {
+                if (ready())
+                    return true;
+                details::cpu_relax();
+            }
+
+            if (m_mode == mode::spin_then_park)
+                return ready();
+
+            while (!ready())
+                std::this_thread::yield();
+            return true;
+        }
+
+        constexpr bool operator==(const idle_strategy&) const = default;
+
+    private:
+        constexpr idle_strategy(mode mode, size_t spin_count)
+            : m_mode{mode}
+            , m_spin_count{spin_count}
+        {
+        }
+
+        mode   m_mode{mode::blocking};
+        size_t m_spin_count{};
+    };
+} // namespace rpp::schedulers
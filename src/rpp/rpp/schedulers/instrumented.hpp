@@ -0,0 +1,328 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/utils/functors.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Thread-safe counters collected by `rpp::schedulers::instrumented` scheduler.
+     * @details All counters are updated with relaxed atomics, so values observed from other threads are eventually consistent.
+     *
+     * @ingroup schedulers
+     */
+    class scheduler_metrics final
+    {
+    public:
+        /**
+         * @brief Histogram of durations with power-of-two buckets: bucket `i` counts durations in range `[2^(i-1), 2^i)` nanoseconds (bucket 0 counts zero durations).
+         */
+        class histogram
+        {
+        public:
+            static constexpr size_t buckets_count = 64;
+
+            void add(duration value)
+            {
+                const auto ns = static_cast<uint64_t>(std::max(value.count(), duration::rep{}));
+                m_buckets[std::min(static_cast<size_t>(std::bit_width(ns)), buckets_count - 1)].fetch_add(1, std::memory_order_relaxed);
+            }
+
+            size_t count() const
+            {
+                size_t res{};
+                for (const auto& bucket : m_buckets)
+                    res += bucket.load(std::memory_order_relaxed);
+                return res;
+            }
+
+            size_t bucket_count(size_t index) const { return m_buckets[index].load(std::memory_order_relaxed); }
+
+            static duration bucket_upper_bound(size_t index) { return duration{index == 0 ? 0 : (duration::rep{1} << std::min(index, size_t{62}))}; }
+
+            /**
+             * @brief Upper bound of the bucket containing provided percentile (for example, 0.99 for p99)
+             */
+            duration percentile(double p) const
+            {
+                const size_t total = count();
+                if (total == 0)
+                    return {};
+
+                const auto target = std::max(size_t{1}, static_cast<size_t>(std::ceil(p * static_cast<double>(total))));
+                size_t     cumulative{};
+                for (size_t i = 0; i < buckets_count; ++i)
+                {
+                    cumulative += bucket_count(i);
+                    if (cumulative >= target)
+                        return bucket_upper_bound(i);
+                }
+                return bucket_upper_bound(buckets_count - 1);
+            }
+
+        private:
+            std::array<std::atomic_size_t, buckets_count> m_buckets{};
+        };
+
+        /**
+         * @brief Amount of schedulables waiting for execution right now
+         */
+        size_t pending_count() const { return m_pending.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Maximal amount of schedulables waiting for execution at the same time
+         */
+        size_t max_depth() const { return m_max_depth.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Amount of executions of schedulables (each re-schedule counts as separate execution)
+         */
+        size_t executed_count() const { return m_executed.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief How late schedulables were started against their scheduled timepoint
+         */
+        const histogram& lateness() const { return m_lateness; }
+
+        /**
+         * @brief How long schedulables were executed
+         */
+        const histogram& execution_time() const { return m_execution_time; }
+
+        /**
+         * @brief Total time spent in execution of schedulables
+         */
+        duration busy_time() const { return duration{m_busy_time.load(std::memory_order_relaxed)}; }
+
+        /**
+         * @brief Time passed since creation of metrics
+         */
+        duration uptime() const { return clock_type::now() - m_start; }
+
+        /**
+         * @brief Time threads of scheduler spent without execution of schedulables since creation of metrics
+         * @param threads_count amount of threads used by scheduler (1 for `new_thread` worker or `run_loop`)
+         */
+        duration idle_time(size_t threads_count = 1) const { return uptime() * static_cast<duration::rep>(threads_count) - busy_time(); }
+
+        /**
+         * @brief Average amount of executions per second since creation of metrics
+         */
+        double tasks_per_second() const
+        {
+            const auto seconds = std::chrono::duration<double>(uptime()).count();
+            return seconds > 0 ? static_cast<double>(executed_count()) / seconds : 0.0;
+        }
+
+        void on_scheduled()
+        {
+            const size_t pending = m_pending.fetch_add(1, std::memory_order_relaxed) + 1;
+            size_t       max     = m_max_depth.load(std::memory_order_relaxed);
+            while (pending > max && !m_max_depth.compare_exchange_weak(max, pending, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void on_started(duration lateness)
+        {
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            m_lateness.add(lateness);
+        }
+
+        void on_executed(duration execution_time)
+        {
+            m_executed.fetch_add(1, std::memory_order_relaxed);
+            m_execution_time.add(execution_time);
+            m_busy_time.fetch_add(execution_time.count(), std::memory_order_relaxed);
+        }
+
+        void on_dropped() { m_pending.fetch_sub(1, std::memory_order_relaxed); }
+
+    private:
+        const time_point           m_start = clock_type::now();
+        std::atomic_size_t         m_pending{};
+        std::atomic_size_t         m_max_depth{};
+        std::atomic_size_t         m_executed{};
+        std::atomic<duration::rep> m_busy_time{};
+        histogram                  m_lateness{};
+        histogram                  m_execution_time{};
+    };
+
+    /**
+     * @brief Scheduler adaptor collecting `rpp::schedulers::scheduler_metrics` for all schedulables scheduled via workers of original scheduler. Scheduling itself is fully delegated to the original scheduler.
+     * @details Metrics are opt-in: only schedulers wrapped with this adaptor pay for it (two clock readings and few relaxed atomic operations per execution). Same metrics object can be shared between multiple schedulers to aggregate them.
+     *
+     * @par Example
+     * \code{.cpp}
+     * auto metrics = std::make_shared<rpp::schedulers::scheduler_metrics>();
+     * const auto scheduler = rpp::schedulers::instrumented{rpp::schedulers::thread_pool{4}, metrics};
+     * // ...
+     * std::cout << metrics->pending_count() << " " << metrics->lateness().percentile(0.99).count() << "ns " << metrics->tasks_per_second() << std::endl;
+     * \endcode
+     *
+     * @ingroup schedulers
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    class instrumented final
+    {
+        using original_worker = rpp::schedulers::utils::get_worker_t<Scheduler>;
+
+        template<typename Fn>
+        class instrumented_fn
+        {
+        public:
+            instrumented_fn(Fn&& fn, std::shared_ptr<scheduler_metrics> metrics, time_point timepoint)
+                : m_fn{std::move(fn)}
+                , m_metrics{std::move(metrics)}
+                , m_timepoint{timepoint}
+            {
+                m_metrics->on_scheduled();
+            }
+
+            instrumented_fn(const Fn& fn, std::shared_ptr<scheduler_metrics> metrics, time_point timepoint)
+                : m_fn{fn}
+                , m_metrics{std::move(metrics)}
+                , m_timepoint{timepoint}
+            {
+                m_metrics->on_scheduled();
+            }
+
+            // copy is not counted as pending schedulable: only original one is expected to be executed or dropped
+            instrumented_fn(const instrumented_fn& other)
+                : m_fn{other.m_fn}
+                , m_metrics{other.m_metrics}
+                , m_timepoint{other.m_timepoint}
+                , m_is_pending{false}
+            {
+            }
+
+            instrumented_fn(instrumented_fn&& other) noexcept
+                : m_fn{std::move(other.m_fn)}
+                , m_metrics{std::move(other.m_metrics)}
+                , m_timepoint{other.m_timepoint}
+                , m_is_pending{std::exchange(other.m_is_pending, false)}
+            {
+            }
+
+            ~instrumented_fn() noexcept
+            {
+                if (m_is_pending)
+                    m_metrics->on_dropped();
+            }
+
+            template<typename... Args>
+            std::invoke_result_t<Fn&, Args&...> operator()(Args&... args)
+            {
+                // timepoints of schedulables are in timebase of original worker, so its clock is used for measurements too
+                const auto start = original_worker::now();
+                if (std::exchange(m_is_pending, false))
+                    m_metrics->on_started(start - m_timepoint);
+
+                auto res = m_fn(args...);
+
+                const auto end = original_worker::now();
+                m_metrics->on_executed(end - start);
+
+                if (res)
+                {
+                    m_timepoint = rpp::utils::overloaded{[end](const delay_from_now& v) { return end + v.value; },
+                                                         [this](const delay_from_this_timepoint& v) { return m_timepoint + v.value; },
+                                                         [](const delay_to& v) { return v.value; }}(res.value());
+                    m_is_pending = true;
+                    m_metrics->on_scheduled();
+                }
+                return res;
+            }
+
+        private:
+            RPP_NO_UNIQUE_ADDRESS Fn           m_fn;
+            std::shared_ptr<scheduler_metrics> m_metrics;
+            time_point                         m_timepoint;
+            bool                               m_is_pending{true};
+        };
+
+        class worker_strategy
+        {
+        public:
+            worker_strategy(original_worker&& original_worker, std::shared_ptr<scheduler_metrics> metrics)
+                : m_original_worker{std::move(original_worker)}
+                , m_metrics{std::move(metrics)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_original_worker.schedule(duration, instrumented_fn<std::decay_t<Fn>>{std::forward<Fn>(fn), m_metrics, now() + duration}, std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_original_worker.schedule(tp, instrumented_fn<std::decay_t<Fn>>{std::forward<Fn>(fn), m_metrics, tp}, std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, rpp::schedulers::priority priority, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_original_worker.schedule(priority, tp, instrumented_fn<std::decay_t<Fn>>{std::forward<Fn>(fn), m_metrics, tp}, std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            auto get_disposable() const
+            {
+                if constexpr (original_worker::is_none_disposable)
+                    return rpp::schedulers::details::none_disposable{};
+                else
+                    return m_original_worker.get_disposable();
+            }
+
+            static rpp::schedulers::time_point now() { return original_worker::now(); }
+
+        private:
+            original_worker                    m_original_worker;
+            std::shared_ptr<scheduler_metrics> m_metrics;
+        };
+
+    public:
+        instrumented(Scheduler scheduler, std::shared_ptr<scheduler_metrics> metrics)
+            : m_scheduler{std::move(scheduler)}
+            , m_metrics{std::move(metrics)}
+        {
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_scheduler.create_worker(), m_metrics};
+        }
+
+        const std::shared_ptr<scheduler_metrics>& get_metrics() const { return m_metrics; }
+
+    private:
+        Scheduler                          m_scheduler;
+        std::shared_ptr<scheduler_metrics> m_metrics;
+    };
+} // namespace rpp::schedulers
@@ -10,14 +10,24 @@
 
 #pragma once
 
+#if defined(RPP_SINGLE_THREADED)
+    #error "rpp::schedulers::new_thread owns threads and can't be used with RPP_SINGLE_THREADED"
+#endif
+
 #include <rpp/disposables/details/base_disposable.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/idle_strategy.hpp>
+#include <rpp/schedulers/thread_config.hpp>
+#include <rpp/schedulers/time_slice.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 namespace rpp::schedulers
 {
@@ -25,106 +35,376 @@ namespace rpp::schedulers
      * @brief Scheduler which schedules invoking of schedulables to another thread via queueing tasks with priority to time_point and order
      * @warning Creates new thread for each "create_worker" call, but not for each schedule
      * @details This scheduler useful when we want to have separate thread for processing starting from some timepoint.
+     * Supports `rpp::schedulers::priority`: ready schedulables of higher priority are executed first.
      * @ingroup schedulers
      */
     class new_thread
     {
+        friend class cached_new_thread;
+
+        struct state_t;
+        class thread_cache;
+
         class disposable final : public rpp::details::base_disposable
         {
         public:
-            disposable() = default;
+            disposable()
+                : m_thread{&data_thread, m_state, idle_strategy{}, time_slice{}}
+            {
+            }
+
+            disposable(const thread_config& config, size_t index)
+                : m_thread{[state = m_state, config, index] {
+                    config.apply(index);
+                    data_thread(state, config.idle, config.slice);
+                }}
+            {
+            }
+
+            explicit disposable(thread_cache& cache)
+            {
+                cache.run(m_state);
+            }
 
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point time_point, Fn&& fn, Handler&& handler, Args&&... args)
             {
+                // `worker::schedule` already updated last "now" for this thread, so no need to request clock again to detect zero-delay schedulables
+                if (time_point <= details::s_last_now_time)
+                {
+                    m_state->immediate_queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                    if (m_state->is_waiting.load(std::memory_order_seq_cst))
+                    {
+                        // lock/unlock to be sure data thread is waiting on cv right now or would see pushed schedulable
+                        {
+                            std::lock_guard lock{m_state->mutex};
+                        }
+                        m_state->cv.notify_one();
+                    }
+                    return;
+                }
+
                 m_state->queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
                 m_state->has_fresh_data.store(true);
             }
 
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point time_point, rpp::schedulers::priority priority, Fn&& fn, Handler&& handler, Args&&... args)
+            {
+                if (priority == rpp::schedulers::priority::normal)
+                    return defer_to(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+
+                m_state->queue.emplace(time_point, priority, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                m_state->has_fresh_data.store(true);
+            }
+
+            size_t get_pending_count() const
+            {
+                std::lock_guard lock{m_state->mutex};
+                return m_state->queue.size() + m_state->immediate_queue.size() + (m_state->is_executing.load() ? 1 : 0);
+            }
+
         private:
             void base_dispose_impl(interface_disposable::Mode) noexcept override
             {
-                if (!m_thread.joinable())
-                    return;
-
                 {
                     std::lock_guard lock{m_state->mutex};
                     m_state->is_disposed = true;
                 }
                 m_state->cv.notify_all();
 
-                if (m_thread.get_id() != std::this_thread::get_id())
-                    m_thread.join();
-                else
-                    m_thread.detach();
+                if (m_thread.joinable())
+                {
+                    if (m_thread.get_id() != std::this_thread::get_id())
+                        m_thread.join();
+                    else
+                        m_thread.detach();
+                    return;
+                }
+
+                // thread obtained from cache: wait till it finishes processing of this worker same as join (except of disposing from this thread)
+                std::unique_lock lock{m_state->mutex};
+                if (m_state->thread_id != std::this_thread::get_id())
+                    m_state->cv.wait(lock, [&] { return m_state->is_finished; });
             }
 
-            struct state_t : public details::shared_queue_data
+        private:
+            std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
+
+            RPP_CALL_DURING_CONSTRUCTION(m_state->queue = details::prioritized_schedulables_queue<current_thread::worker_strategy>(m_state));
+
+            std::thread m_thread{};
+        };
+
+        struct state_t : public details::shared_queue_data
+        {
+            details::prioritized_schedulables_queue<current_thread::worker_strategy> queue{};
+            details::mpsc_schedulables_queue<current_thread::worker_strategy>        immediate_queue{};
+            std::atomic_bool                                                         is_disposed{};
+            bool                                                                     is_finished{};
+            std::thread::id                                                          thread_id{};
+            std::atomic_bool                                                         has_fresh_data{false};
+            std::atomic_bool                                                         is_executing{false};
+            std::atomic_bool                                                         is_waiting{false};
+
+            // can be called only from data thread
+            bool is_empty() const { return queue.is_empty() && immediate_queue.is_empty(); }
+
+            void finish()
             {
-                details::schedulables_queue<current_thread::worker_strategy> queue{};
-                bool                                                         is_disposed{};
-                std::atomic_bool                                             has_fresh_data{false};
-            };
+                {
+                    std::lock_guard lock{mutex};
+                    is_finished = true;
+                }
+                cv.notify_all();
+            }
+        };
 
-            static void data_thread(std::shared_ptr<state_t> state)
+        static void data_thread(std::shared_ptr<state_t> state, const idle_strategy& idle, const time_slice& slice)
+        {
             {
-                current_thread::s_queue = &state->queue;
+                std::lock_guard lock{state->mutex};
+                state->thread_id = std::this_thread::get_id();
+            }
+            current_thread::s_queue = &state->queue.get_lane(rpp::schedulers::priority::normal);
 
-                while (true)
+            const details::cached_now_loop_scope cached_now_scope{};
+            while (true)
+            {
+                std::unique_lock lock{state->mutex};
+                if (state->is_empty() && state->is_disposed)
+                    break;
+
+                if (state->is_empty() && !idle.is_blocking())
+                {
+                    // spin without lock to not block producers. `has_fresh_data` is raised by any emplace into timed queue
+                    lock.unlock();
+                    idle.wait([&] { return !state->immediate_queue.is_empty() || state->has_fresh_data.load(std::memory_order_relaxed) || state->is_disposed.load(std::memory_order_relaxed); });
+                    lock.lock();
+                }
+
+                if (state->is_empty())
                 {
-                    std::unique_lock lock{state->mutex};
-                    if (state->queue.is_empty() && state->is_disposed)
-                        break;
+                    state->is_waiting.store(true, std::memory_order_seq_cst);
+                    state->cv.wait(lock, [&] { return !state->is_empty() || state->is_disposed; });
+                    state->is_waiting.store(false, std::memory_order_relaxed);
+                }
 
-                    state->cv.wait(lock, [&] { return !state->queue.is_empty() || state->is_disposed; });
+                if (state->is_empty())
+                    break;
 
-                    if (state->queue.is_empty())
-                        break;
+                auto top = pop_next(*state, lock);
+                if (!top || top->is_disposed())
+                    continue;
 
-                    if (state->queue.top()->is_disposed())
-                    {
-                        state->queue.pop();
-                        continue;
-                    }
+                // without time slice pending delayed schedulables are checked after each execution of recursive schedulable, otherwise - once per slice
+                state->has_fresh_data.store(slice.is_unlimited() && !state->queue.is_empty());
+                state->is_executing.store(true);
+                lock.unlock();
 
-                    if (details::s_last_now_time < state->queue.top()->get_timepoint())
+                details::time_slice_budget budget{slice};
+                while (true)
+                {
+                    details::invalidate_cached_now();
+                    if (const auto res = top->make_advanced_call())
                     {
-                        if (const auto now = worker_strategy::now(); now < state->queue.top()->get_timepoint())
+                        if (!top->is_disposed())
                         {
-                            state->cv.wait_for(lock, state->queue.top()->get_timepoint() - now, [&] { return state->queue.top()->is_disposed() || worker_strategy::now() >= state->queue.top()->get_timepoint(); });
-                            continue;
+                            if (res->can_run_immediately() && !state->has_fresh_data.load() && state->immediate_queue.is_empty() && budget.consume())
+                                continue;
+
+                            state->queue.emplace(top->handle_advanced_call(res.value()), std::move(top));
                         }
                     }
+                    break;
+                }
+                state->is_executing.store(false);
+            }
 
-                    auto top = state->queue.pop();
-                    state->has_fresh_data.store(!state->queue.is_empty());
-                    lock.unlock();
+            current_thread::s_queue = nullptr;
+        }
+
+        /**
+         * @brief Pops schedulable to be executed next or waits till some schedulable becomes ready (then returns nullptr)
+         */
+        static details::schedulable_ptr pop_next(state_t& state, std::unique_lock<std::recursive_mutex>& lock)
+        {
+            const auto* immediate = state.immediate_queue.front();
+            auto&       normal    = state.queue.get_lane(rpp::schedulers::priority::normal);
 
-                    while (true)
+            // lanes of other priorities are used rarely, so clock is requested for each schedulable only when they are not empty
+            if (state.queue.has_prioritized())
+            {
+                auto* lane = state.queue.select_ready(worker_strategy::now(), immediate != nullptr);
+                if (!lane)
+                {
+                    wait_for_top(state, lock, state.queue.earliest_timepoint());
+                    return {};
+                }
+                if (lane != &normal)
+                    return lane->pop();
+            }
+
+            // zero-delay schedulables are executed first, unless timed queue has ready schedulable which should be executed earlier
+            if (immediate && (normal.is_empty() || immediate->get_timepoint() < normal.top()->get_timepoint()))
+                return state.immediate_queue.pop();
+
+            if (normal.top()->is_disposed())
+                return normal.pop();
+
+            if (const auto top_timepoint = normal.top()->get_timepoint(); details::s_last_now_time < top_timepoint && worker_strategy::now() < top_timepoint)
+            {
+                wait_for_top(state, lock, top_timepoint);
+                return {};
+            }
+
+            return normal.pop();
+        }
+
+        static void wait_for_top(state_t& state, std::unique_lock<std::recursive_mutex>& lock, time_point top_timepoint)
+        {
+            state.is_waiting.store(true, std::memory_order_seq_cst);
+            // earlier schedulable emplaced during waiting becomes new top and requires new deadline
+            details::wait_until(state.cv, lock, top_timepoint, [&] { return !state.immediate_queue.is_empty() || state.queue.earliest_timepoint() < top_timepoint || state.queue.has_ready(worker_strategy::now()); });
+            state.is_waiting.store(false, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Cache of parked threads used to process workers of `cached_new_thread`. Each thread processes exactly one worker at a time.
+         */
+        class thread_cache final : public std::enable_shared_from_this<thread_cache>
+        {
+            struct cached_thread
+            {
+                std::mutex               mutex{};
+                std::condition_variable  cv{};
+                std::shared_ptr<state_t> state{};
+                bool                     is_stopped{};
+            };
+
+        public:
+            thread_cache(duration keep_alive, size_t max_idle_threads, thread_config config)
+                : m_keep_alive{keep_alive}
+                , m_max_idle_threads{max_idle_threads}
+                , m_config{std::move(config)}
+            {
+            }
+
+            thread_cache(const thread_cache&) = delete;
+            thread_cache(thread_cache&&)      = delete;
+
+            ~thread_cache() noexcept
+            {
+                std::lock_guard lock{m_mutex};
+                for (const auto& thread : m_idle_threads)
+                {
                     {
-                        if (const auto res = top->make_advanced_call())
-                        {
-                            if (!top->is_disposed())
-                            {
-                                if (res->can_run_immediately() && !state->has_fresh_data.load())
-                                    continue;
+                        std::lock_guard thread_lock{thread->mutex};
+                        thread->is_stopped = true;
+                    }
+                    thread->cv.notify_one();
+                }
+            }
 
-                                state->queue.emplace(top->handle_advanced_call(res.value()), std::move(top));
-                            }
-                        }
-                        break;
+            void run(std::shared_ptr<state_t> state)
+            {
+                if (const auto thread = pop_idle())
+                {
+                    {
+                        std::lock_guard lock{thread->mutex};
+                        thread->state = std::move(state);
                     }
+                    thread->cv.notify_one();
+                    return;
                 }
 
-                current_thread::s_queue = nullptr;
+                auto thread   = std::make_shared<cached_thread>();
+                thread->state = std::move(state);
+                std::thread{[weak_cache = weak_from_this(), thread = std::move(thread), keep_alive = m_keep_alive, config = m_config, index = m_threads_count++]() mutable {
+                    config.apply(index);
+                    thread_loop(std::move(weak_cache), std::move(thread), keep_alive, config.idle, config.slice);
+                }}.detach();
             }
 
         private:
-            std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
+            static void thread_loop(std::weak_ptr<thread_cache> weak_cache, std::shared_ptr<cached_thread> thread, duration keep_alive, const idle_strategy& idle, const time_slice& slice)
+            {
+                auto state = std::exchange(thread->state, {});
+                while (state)
+                {
+                    data_thread(state, idle, slice);
+
+                    // park thread before notifying disposing thread, so sequential create_worker would re-use it
+                    bool is_parked{};
+                    if (const auto cache = weak_cache.lock())
+                        is_parked = cache->push_idle(thread);
+
+                    state->finish();
+                    state.reset();
+                    if (!is_parked)
+                        return;
 
-            RPP_CALL_DURING_CONSTRUCTION(m_state->queue = details::schedulables_queue<current_thread::worker_strategy>(m_state));
+                    state = wait_for_state(weak_cache, *thread, keep_alive);
+                }
+            }
+
+            static std::shared_ptr<state_t> wait_for_state(const std::weak_ptr<thread_cache>& weak_cache, cached_thread& thread, duration keep_alive)
+            {
+                std::unique_lock lock{thread.mutex};
+                const auto       has_state_or_stopped = [&] { return thread.state || thread.is_stopped; };
+                if (!thread.cv.wait_for(lock, keep_alive, has_state_or_stopped))
+                {
+                    lock.unlock();
+                    if (const auto cache = weak_cache.lock(); cache && cache->remove_idle(thread))
+                        return {};
+
+                    // thread already obtained by some worker (or cache is destroyed and thread is stopped)
+                    lock.lock();
+                    thread.cv.wait(lock, has_state_or_stopped);
+                }
+                return std::exchange(thread.state, {});
+            }
+
+            bool push_idle(const std::shared_ptr<cached_thread>& thread)
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_idle_threads.size() >= m_max_idle_threads)
+                    return false;
+
+                m_idle_threads.push_back(thread);
+                return true;
+            }
+
+            std::shared_ptr<cached_thread> pop_idle()
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_idle_threads.empty())
+                    return {};
+
+                // last parked thread is the "warmest" one
+                auto thread = std::move(m_idle_threads.back());
+                m_idle_threads.pop_back();
+                return thread;
+            }
+
+            bool remove_idle(const cached_thread& thread)
+            {
+                std::lock_guard lock{m_mutex};
+                const auto      itr = std::find_if(m_idle_threads.cbegin(), m_idle_threads.cend(), [&](const auto& t) { return t.get() == &thread; });
+                if (itr == m_idle_threads.cend())
+                    return false;
+
+                m_idle_threads.erase(itr);
+                return true;
+            }
 
-            std::thread m_thread{&data_thread, m_state};
+        private:
+            const duration                              m_keep_alive;
+            const size_t                                m_max_idle_threads;
+            const thread_config                         m_config;
+            std::atomic_size_t                          m_threads_count{};
+            std::mutex                                  m_mutex{};
+            std::vector<std::shared_ptr<cached_thread>> m_idle_threads{};
         };
 
     public:
@@ -133,23 +413,54 @@ namespace rpp::schedulers
         public:
             worker_strategy() = default;
 
+            worker_strategy(const thread_config& config, size_t index)
+                : m_state{disposable_wrapper_impl<disposable>::make(config, index)}
+            {
+            }
+
+            explicit worker_strategy(thread_cache& cache)
+                : m_state{disposable_wrapper_impl<disposable>::make(cache)}
+            {
+            }
+
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
             {
-                m_state.lock()->defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                m_raw_state->defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, rpp::schedulers::priority priority, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_raw_state->defer_to(tp, priority, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
             rpp::disposable_wrapper get_disposable() const { return m_state; }
 
+            /**
+             * @brief Amount of schedulables queued to this worker's thread (including currently executing one)
+             */
+            size_t get_pending_count() const { return m_raw_state->get_pending_count(); }
+
             static rpp::schedulers::time_point now() { return details::now(); }
 
         private:
             disposable_wrapper_impl<disposable> m_state = disposable_wrapper_impl<disposable>::make();
+            // worker owns state (wrapper is always strong), so raw pointer is valid while worker is alive and there is no need to pay for atomic refcounting of `lock()` on each schedule
+            disposable* m_raw_state = m_state.lock().get();
         };
 
         static rpp::schedulers::worker<worker_strategy> create_worker()
         {
             return rpp::schedulers::worker<worker_strategy>{};
         }
+
+        /**
+         * @brief Creates worker with new thread configured via provided config (thread index is 0)
+         */
+        static rpp::schedulers::worker<worker_strategy> create_worker(const thread_config& config)
+        {
+            return rpp::schedulers::worker<worker_strategy>{config, size_t{}};
+        }
     };
 } // namespace rpp::schedulers
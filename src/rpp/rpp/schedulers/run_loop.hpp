@@ -17,12 +17,32 @@
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/schedulers/details/queue.hpp>
 #include <rpp/schedulers/details/worker.hpp>
+#include <rpp/schedulers/idle_strategy.hpp>
 #include <rpp/utils/functors.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#if defined(__linux__)
+    #include <sys/timerfd.h>
+    #include <unistd.h>
+
+    #include <cerrno>
+    #include <system_error>
+#endif
+
 namespace rpp::schedulers
 {
     /**
      * @brief scheduler which schedules execution via queueing tasks, but execution of tasks should be manually dispatched
+     * @details Supports `rpp::schedulers::priority`: ready schedulables of higher priority are dispatched first.
      * @warning you need manually dispatch events for this scheduler in some thread.
      *
      * @ingroup schedulers
@@ -34,7 +54,21 @@ namespace rpp::schedulers
         class state_t final : public rpp::details::base_disposable
         {
         public:
-            ~state_t() noexcept override { dispose(); }
+            state_t() = default;
+
+            explicit state_t(idle_strategy idle)
+                : m_idle{idle}
+            {
+            }
+
+            ~state_t() noexcept override
+            {
+                dispose();
+#if defined(__linux__)
+                if (m_fd >= 0)
+                    close(m_fd);
+#endif
+            }
 
             template<typename... Args>
             void emplace_and_notify(time_point timepoint, Args&&... args)
@@ -45,32 +79,131 @@ namespace rpp::schedulers
                 {
                     std::lock_guard lock{m_mutex};
                     m_queue.emplace(timepoint, std::forward<Args>(args)...);
+                    m_is_empty.store(false, std::memory_order_relaxed);
+                    arm_fd_unsafe(timepoint);
                 }
-                m_cv.notify_one();
+                // no need to wake up anyone if dispatching thread is spinning or not dispatching at all
+                if (m_waiting.load(std::memory_order_seq_cst) != 0)
+                    m_cv.notify_one();
             }
 
-            std::shared_ptr<details::schedulable_base> pop(bool wait)
+            details::schedulable_ptr pop(bool wait)
             {
                 while (!is_disposed())
                 {
+                    if (wait && m_is_empty.load(std::memory_order_relaxed))
+                        m_idle.wait([&] { return !m_is_empty.load(std::memory_order_relaxed) || is_disposed(); });
+
                     std::unique_lock lock{m_mutex};
-                    m_cv.wait(lock, [&] { return !wait || is_disposed() || !m_queue.is_empty(); });
+                    if (wait)
+                        wait_impl(lock, [&] { return is_disposed() || !m_queue.is_empty(); });
 
                     if (is_disposed())
                         break;
 
-                    const auto now = worker_strategy::now();
-                    if (is_any_ready_schedulable_unsafe(now))
-                        return m_queue.pop();
+                    if (auto* lane = m_queue.select_ready(worker_strategy::now()))
+                    {
+                        auto top = lane->pop();
+                        m_is_empty.store(m_queue.is_empty(), std::memory_order_relaxed);
+                        return top;
+                    }
 
                     if (!wait)
                         break;
 
-                    m_cv.wait_for(lock, m_queue.top()->get_timepoint() - now, [&]() { return is_disposed() || !m_queue.is_empty() || m_queue.top()->get_timepoint() <= worker_strategy::now(); });
+                    // earlier schedulable emplaced during waiting becomes new top and requires new deadline
+                    const auto top_timepoint = m_queue.earliest_timepoint();
+                    wait_impl(lock, [&]() { return is_disposed() || m_queue.is_empty() || m_queue.earliest_timepoint() < top_timepoint || top_timepoint <= worker_strategy::now(); }, top_timepoint);
                 }
                 return {};
             }
 
+            /**
+             * @brief Pops all ready schedulables (up to `max_count`) under single lock
+             */
+            void pop_ready(std::vector<details::schedulable_ptr>& out, size_t max_count)
+            {
+                if (is_disposed())
+                    return;
+
+                std::lock_guard lock{m_mutex};
+                const auto      now = worker_strategy::now();
+                while (out.size() < max_count)
+                {
+                    auto* lane = m_queue.select_ready(now);
+                    if (!lane)
+                        break;
+                    out.push_back(lane->pop());
+                }
+                m_is_empty.store(m_queue.is_empty(), std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Returns popped but not executed schedulables back to the queue under single lock
+             */
+            template<typename It>
+            void push_back_unprocessed(It begin, It end)
+            {
+                if (begin == end || is_disposed())
+                    return;
+
+                std::lock_guard lock{m_mutex};
+                for (; begin != end; ++begin)
+                {
+                    const auto timepoint = (*begin)->get_timepoint();
+                    m_queue.emplace(timepoint, std::move(*begin));
+                }
+                m_is_empty.store(m_queue.is_empty(), std::memory_order_relaxed);
+            }
+
+            std::optional<time_point> get_next_timepoint()
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_queue.is_empty())
+                    return std::nullopt;
+                return m_queue.earliest_timepoint();
+            }
+
+#if defined(__linux__)
+            int get_fd()
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_fd < 0)
+                {
+                    m_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+                    if (m_fd < 0)
+                        throw std::system_error{errno, std::system_category(), "run_loop can't create timerfd"};
+
+                    m_has_fd.store(true, std::memory_order_release);
+
+                    if (!m_queue.is_empty())
+                        arm_fd_unsafe(m_queue.earliest_timepoint());
+                }
+                return m_fd;
+            }
+#endif
+
+            /**
+             * @brief Clears readiness of fd (if any) and re-arms it to the earliest pending schedulable. Expected to be called after each dispatch.
+             */
+            void on_dispatched()
+            {
+#if defined(__linux__)
+                if (!m_has_fd.load(std::memory_order_acquire))
+                    return;
+
+                std::lock_guard lock{m_mutex};
+                uint64_t        expirations{};
+                [[maybe_unused]] const auto _ = read(m_fd, &expirations, sizeof(expirations));
+
+                m_fd_timepoint.reset();
+                if (!m_queue.is_empty())
+                    arm_fd_unsafe(m_queue.earliest_timepoint());
+                else
+                    set_fd_time_unsafe(itimerspec{});
+#endif
+            }
+
             bool is_any_ready_schedulable()
             {
                 std::lock_guard lock{m_mutex};
@@ -84,25 +217,70 @@ namespace rpp::schedulers
             }
 
         private:
+            void arm_fd_unsafe([[maybe_unused]] time_point timepoint)
+            {
+#if defined(__linux__)
+                if (m_fd < 0 || (m_fd_timepoint && m_fd_timepoint.value() <= timepoint))
+                    return;
+
+                m_fd_timepoint = timepoint;
+
+                // std::chrono::steady_clock is CLOCK_MONOTONIC on linux. Zero value disarms timer, so use at least 1ns (anyway it is in the past)
+                const auto ns = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint.time_since_epoch()).count(), std::chrono::nanoseconds::rep{1});
+
+                itimerspec spec{};
+                spec.it_value.tv_sec  = static_cast<time_t>(ns / 1'000'000'000);
+                spec.it_value.tv_nsec = static_cast<long>(ns % 1'000'000'000);
+                set_fd_time_unsafe(spec);
+#endif
+            }
+
+#if defined(__linux__)
+            void set_fd_time_unsafe(const itimerspec& spec)
+            {
+                timerfd_settime(m_fd, TFD_TIMER_ABSTIME, &spec, nullptr);
+            }
+#endif
+
+            template<typename Pred>
+            void wait_impl(std::unique_lock<std::mutex>& lock, Pred&& pred, std::optional<time_point> timepoint = {})
+            {
+                // counter is changed under lock, so producer either sees it after own emplace or waiting thread sees emplaced schedulable
+                m_waiting.fetch_add(1, std::memory_order_seq_cst);
+                if (timepoint)
+                    details::wait_until(m_cv, lock, timepoint.value(), std::forward<Pred>(pred));
+                else
+                    m_cv.wait(lock, std::forward<Pred>(pred));
+                m_waiting.fetch_sub(1, std::memory_order_relaxed);
+            }
+
             bool is_any_ready_schedulable_unsafe(time_point now = worker_strategy::now()) const
             {
-                return !m_queue.is_empty() && (m_queue.top()->is_disposed() || m_queue.top()->get_timepoint() <= now);
+                return m_queue.has_ready(now);
             }
 
             void base_dispose_impl(interface_disposable::Mode) noexcept override
             {
                 {
                     std::lock_guard lock{m_mutex};
-                    m_queue = details::schedulables_queue<worker_strategy>{};
+                    m_queue = details::prioritized_schedulables_queue<worker_strategy>{};
+                    m_is_empty.store(true, std::memory_order_relaxed);
                 }
                 m_cv.notify_one();
             }
 
         private:
-            std::mutex                                   m_mutex{};
-            details::schedulables_queue<worker_strategy> m_queue{};
+            std::mutex                                               m_mutex{};
+            details::prioritized_schedulables_queue<worker_strategy> m_queue{};
 
             std::condition_variable m_cv{};
+            std::atomic_size_t      m_waiting{};
+            std::atomic_bool        m_is_empty{true};
+            const idle_strategy     m_idle{};
+
+            int                       m_fd{-1};
+            std::atomic_bool          m_has_fd{};
+            std::optional<time_point> m_fd_timepoint{};
         };
 
         class worker_strategy
@@ -120,6 +298,13 @@ namespace rpp::schedulers
                     shared->emplace_and_notify(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, rpp::schedulers::priority priority, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                if (const auto shared = m_state.lock())
+                    shared->emplace_and_notify(tp, priority, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
             static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
 
             static rpp::schedulers::time_point now() { return details::now(); }
@@ -129,6 +314,32 @@ namespace rpp::schedulers
         };
 
     public:
+        /**
+         * @brief Result of `run_loop::dispatch_batch`
+         */
+        struct batch_result
+        {
+            /**
+             * @brief Amount of executed schedulables
+             */
+            size_t executed_count{};
+
+            /**
+             * @brief Timepoint of the earliest pending schedulable (can be already in the past in case of batch was limited by budgets) or nullopt if queue is empty. Host loop can sleep till this timepoint if nothing else is expected to be scheduled.
+             */
+            std::optional<time_point> next_timepoint{};
+        };
+
+        run_loop() = default;
+
+        /**
+         * @param idle strategy used by `dispatch()` to wait for new schedulables when queue is empty
+         */
+        explicit run_loop(idle_strategy idle)
+            : m_state{std::make_shared<state_t>(idle)}
+        {
+        }
+
         bool is_empty() const
         {
             return m_state->is_empty();
@@ -149,6 +360,68 @@ namespace rpp::schedulers
             dispatch_impl(true);
         }
 
+        /**
+         * @brief Executes all schedulables ready at the moment of call without waiting. Unlike `dispatch_if_ready()` called in a loop, all ready schedulables are extracted under single lock.
+         * @details Schedulables re-scheduled or scheduled during the batch are executed by next call. At least one ready schedulable is executed even if `time_budget` is zero.
+         *
+         * @param max_items maximal amount of schedulables to execute
+         * @param time_budget remaining ready schedulables are left in the queue after this duration is exceeded
+         * @return amount of executed schedulables and timepoint of next pending schedulable
+         */
+        batch_result dispatch_batch(size_t max_items = std::numeric_limits<size_t>::max(), duration time_budget = duration::max()) const
+        {
+            std::vector<details::schedulable_ptr> ready{};
+            m_state->pop_ready(ready, max_items);
+
+            const bool       has_budget = time_budget != duration::max();
+            const time_point deadline   = has_budget ? worker_strategy::now() + time_budget : time_point::max();
+
+            const details::cached_now_loop_scope cached_now_scope{};
+
+            batch_result res{};
+            auto         it = ready.begin();
+            for (; it != ready.end(); ++it)
+            {
+                if (has_budget && res.executed_count != 0 && worker_strategy::now() >= deadline)
+                    break;
+
+                auto& top = *it;
+                if (top->is_disposed())
+                    continue;
+
+                details::invalidate_cached_now();
+                ++res.executed_count;
+                if (const auto timepoint = (*top)())
+                    m_state->emplace_and_notify(timepoint.value(), std::move(top));
+            }
+
+            m_state->push_back_unprocessed(it, ready.end());
+            m_state->on_dispatched();
+            res.next_timepoint = m_state->get_next_timepoint();
+            return res;
+        }
+
+#if defined(__linux__)
+        /**
+         * @brief Returns file descriptor which becomes readable when some schedulable is ready to be dispatched (including delayed ones when their timepoint comes). Expected to be added to an existing `epoll`/`poll` set.
+         * @details Fd is `timerfd` created on first call and owned by run_loop. Each `dispatch*` call clears its readiness and re-arms it to the earliest pending schedulable, so host loop is expected to call `dispatch_batch()` each time fd becomes readable. (Linux only)
+         *
+         * @par Example
+         * \code{.cpp}
+         * epoll_event event{.events = EPOLLIN};
+         * epoll_ctl(epoll_fd, EPOLL_CTL_ADD, run_loop.get_fd(), &event);
+         * // ... when fd becomes readable:
+         * run_loop.dispatch_batch();
+         * \endcode
+         *
+         * @throws std::system_error if timerfd can't be created
+         */
+        int get_fd() const
+        {
+            return m_state->get_fd();
+        }
+#endif
+
         rpp::schedulers::worker<worker_strategy> create_worker() const
         {
             return rpp::schedulers::worker<worker_strategy>{m_state};
@@ -157,14 +430,14 @@ namespace rpp::schedulers
     private:
         void dispatch_impl(bool wait) const
         {
-            if (auto top = m_state->pop(wait))
+            if (auto top = m_state->pop(wait); top && !top->is_disposed())
             {
-                if (top->is_disposed())
-                    return;
+                const details::cached_now_loop_scope cached_now_scope{};
 
                 if (const auto timepoint = (*top)())
                     m_state->emplace_and_notify(timepoint.value(), std::move(top));
             }
+            m_state->on_dispatched();
         }
 
     private:
@@ -0,0 +1,216 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/utils.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler adaptor where each worker is lightweight serialized queue ("strand") executed on top of original scheduler.
+     * @details Each call to `create_worker()` creates new strand: schedulables of the same strand are executed serially (at most one thread runs strand at a time) and in order of their timepoints (and in FIFO order for equal timepoints), while different strands are executed in parallel.
+     * Strand doesn't own any thread: it creates one worker of original scheduler and, when it has ready schedulables, schedules single "drain" schedulable to this worker (for example, `work_stealing_pool` executes it by any free thread, `thread_pool` - by thread assigned to the worker via its `assignment_policy`). After executing batch of schedulables strand re-schedules itself to let other strands use the thread.
+     * Strand costs one small heap-allocated state plus one worker of original scheduler, so it is fine to have hundreds of thousands of them over pools (but each strand over `new_thread` keeps its own thread).
+     *
+     * @par Example
+     * \code{.cpp}
+     * const auto strands = rpp::schedulers::strand{rpp::schedulers::work_stealing_pool{}};
+     * // each instrument is processed serially, different instruments - in parallel
+     * for (auto& instrument : instruments)
+     *     instrument.observable | rpp::operators::observe_on(strands) | rpp::operators::subscribe(...);
+     * \endcode
+     *
+     * @ingroup schedulers
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    class strand final
+    {
+        using original_worker = rpp::schedulers::utils::get_worker_t<Scheduler>;
+
+        class worker_strategy;
+
+        // handler of drain schedulable: drain has to be executed even if all workers of strand are destroyed to execute already scheduled schedulables
+        struct drain_handler
+        {
+            static constexpr bool is_disposed() { return false; }
+
+            static void on_error(const std::exception_ptr&) {}
+        };
+
+        class state_t final : public std::enable_shared_from_this<state_t>
+        {
+            // amount of schedulables executed by one drain before yielding thread to other strands
+            static constexpr size_t max_batch_size = 64;
+
+        public:
+            explicit state_t(const Scheduler& scheduler)
+                : m_worker{scheduler.create_worker()}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void emplace(time_point tp, Fn&& fn, Handler&& handler, Args&&... args)
+            {
+                std::unique_lock lock{m_mutex};
+                m_queue.emplace(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+
+                // running drain would execute it anyway
+                if (m_is_running)
+                    return;
+
+                if (tp <= worker_strategy::now())
+                {
+                    m_is_running = true;
+                    lock.unlock();
+                    schedule_drain(std::nullopt);
+                }
+                else if (!m_timer || tp < m_timer.value())
+                {
+                    m_timer = tp;
+                    lock.unlock();
+                    schedule_drain(tp);
+                }
+            }
+
+        private:
+            void schedule_drain(std::optional<time_point> timer)
+            {
+                auto fn = [self = this->shared_from_this(), timer](const drain_handler&) {
+                    self->drain(timer);
+                    return optional_delay_to{};
+                };
+
+                if (timer)
+                    m_worker.schedule(timer.value(), std::move(fn), drain_handler{});
+                else
+                    m_worker.schedule(std::move(fn), drain_handler{});
+            }
+
+            void drain(std::optional<time_point> timer)
+            {
+                std::unique_lock lock{m_mutex};
+                if (timer)
+                {
+                    if (m_timer == timer)
+                        m_timer.reset();
+
+                    // other drain is executing strand right now
+                    if (m_is_running)
+                        return;
+                    m_is_running = true;
+                }
+
+                for (size_t i = 0; i < max_batch_size; ++i)
+                {
+                    while (!m_queue.is_empty() && m_queue.top()->is_disposed())
+                        m_queue.pop();
+
+                    if (m_queue.is_empty())
+                    {
+                        m_is_running = false;
+                        return;
+                    }
+
+                    if (const auto tp = m_queue.top()->get_timepoint(); tp > details::s_last_now_time && tp > worker_strategy::now())
+                    {
+                        m_is_running = false;
+                        if (m_timer && m_timer.value() <= tp)
+                            return;
+
+                        m_timer = tp;
+                        lock.unlock();
+                        schedule_drain(tp);
+                        return;
+                    }
+
+                    auto top = m_queue.pop();
+                    lock.unlock();
+
+                    details::invalidate_cached_now();
+                    if (const auto res = top->make_advanced_call())
+                    {
+                        if (!top->is_disposed())
+                        {
+                            lock.lock();
+                            m_queue.emplace(top->handle_advanced_call(res.value()), std::move(top));
+                            lock.unlock();
+                        }
+                    }
+
+                    lock.lock();
+                }
+
+                // strand is still running: continue via original scheduler to let other strands use the thread
+                lock.unlock();
+                schedule_drain(std::nullopt);
+            }
+
+        private:
+            // recursive to allow destructors of schedulables to schedule something to the same strand
+            std::recursive_mutex                         m_mutex{};
+            details::schedulables_queue<worker_strategy> m_queue{};
+            std::optional<time_point>                    m_timer{};
+            bool                                         m_is_running{};
+            original_worker                              m_worker;
+        };
+
+        class worker_strategy
+        {
+        public:
+            explicit worker_strategy(std::shared_ptr<state_t> state)
+                : m_state{std::move(state)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                if (handler.is_disposed())
+                    return;
+
+                m_state->emplace(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
+
+            static rpp::schedulers::time_point now() { return original_worker::now(); }
+
+        private:
+            std::shared_ptr<state_t> m_state;
+        };
+
+    public:
+        explicit strand(Scheduler scheduler = {})
+            : m_scheduler{std::move(scheduler)}
+        {
+        }
+
+        /**
+         * @brief Creates new strand. Copies of returned worker share the same strand.
+         */
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{std::make_shared<state_t>(m_scheduler)};
+        }
+
+    private:
+        Scheduler m_scheduler;
+    };
+} // namespace rpp::schedulers
@@ -41,8 +41,7 @@ public:
                 if (time_point > s_current_time)
                     return;
 
-                auto fn = queue.top();
-                queue.pop();
+                auto fn = queue.pop();
 
                 if (fn->is_disposed())
                     continue;
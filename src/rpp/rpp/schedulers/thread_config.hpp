@@ -0,0 +1,200 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/idle_strategy.hpp>
+#include <rpp/schedulers/time_slice.hpp>
+#include <rpp/schedulers/timer_precision.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+    #include <pthread.h>
+#endif
+
+#if defined(__linux__)
+    #include <sched.h>
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Configuration applied by thread-owning schedulers (`new_thread`, `cached_new_thread`, `thread_pool`, `computational`, `work_stealing_pool`) to each of their threads right after its start.
+     * @details All settings are applied in "best effort" manner: if some setting is not supported by platform or rejected by OS, it is silently ignored.
+     *
+     * @par Example
+     * \code{.cpp}
+     * // pool of 8 threads with names "rpp-io-0".."rpp-io-7" pinned to cpus of NUMA node 1 one-by-one
+     * auto config = rpp::schedulers::thread_config::numa_node(1);
+     * config.name = "rpp-io";
+     * config.pin_to_single_cpu = true;
+     * const auto scheduler = rpp::schedulers::thread_pool{8, rpp::schedulers::thread_pool::assignment_policy::round_robin, config};
+     * \endcode
+     *
+     * @ingroup schedulers
+     */
+    struct thread_config
+    {
+        /**
+         * @brief Prefix of OS thread name. Thread is named as `<name>-<index>`. Linux limits names with 15 characters, so longer names are truncated.
+         */
+        std::string name{};
+
+        /**
+         * @brief Set of cpus threads are allowed to run on. Empty set means "don't change affinity". (Linux only)
+         */
+        std::vector<size_t> cpus{};
+
+        /**
+         * @brief If true, thread with index `i` is pinned to single cpu `cpus[i % cpus.size()]` instead of whole set
+         */
+        bool pin_to_single_cpu{};
+
+        /**
+         * @brief Scheduling priority of thread as "nice" value (from -20 for highest priority to 19 for the lowest one). (Linux only)
+         */
+        std::optional<int> priority{};
+
+        /**
+         * @brief Custom callback invoked from the thread after applying of all other settings. Receives index of thread inside scheduler.
+         */
+        std::function<void(size_t)> on_thread_start{};
+
+        /**
+         * @brief Strategy used by thread to wait for new schedulables when it has nothing to do. Used by schedulers with thread per worker (`new_thread`, `cached_new_thread`, `thread_pool`, `computational`), `work_stealing_pool` always blocks.
+         */
+        idle_strategy idle{};
+
+        /**
+         * @brief Precision of waiting for delayed schedulables by thread. See `rpp::schedulers::timer_precision` for details.
+         */
+        timer_precision timer{};
+
+        /**
+         * @brief Budget of continuous execution of recursive schedulable before re-queueing it. Used by schedulers with thread per worker (`new_thread`, `cached_new_thread`, `thread_pool`, `computational`). See `rpp::schedulers::time_slice` for details.
+         */
+        time_slice slice{};
+
+        /**
+         * @brief Creates config with cpus of provided NUMA node obtained from `/sys/devices/system/node/node<N>/cpulist`. (Linux only, empty set of cpus otherwise)
+         */
+        static thread_config numa_node(size_t node)
+        {
+            thread_config config{};
+            config.cpus = parse_cpu_list(read_file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+            return config;
+        }
+
+        /**
+         * @brief Applies config to the calling thread
+         * @param index index of thread inside scheduler
+         */
+        void apply(size_t index) const
+        {
+            if (!name.empty())
+                set_name(name + "-" + std::to_string(index));
+
+            if (!cpus.empty())
+                set_affinity(pin_to_single_cpu ? std::vector<size_t>{cpus[index % cpus.size()]} : cpus);
+
+            if (priority)
+                set_priority(priority.value());
+
+            if (timer.is_precise())
+                timer.apply_to_current_thread();
+
+            if (on_thread_start)
+                on_thread_start(index);
+        }
+
+        bool is_empty() const { return name.empty() && cpus.empty() && !priority && !on_thread_start && idle.is_blocking() && !timer.is_precise() && slice.is_unlimited(); }
+
+        /**
+         * @brief Parses cpu list in linux format like "0-3,8,10-11"
+         */
+        static std::vector<size_t> parse_cpu_list(const std::string& list)
+        {
+            std::vector<size_t> res{};
+            size_t              pos{};
+            while (pos < list.size())
+            {
+                const size_t end   = std::min(list.find(',', pos), list.size());
+                const auto   range = list.substr(pos, end - pos);
+                pos                = end + 1;
+
+                const size_t dash = range.find('-');
+                try
+                {
+                    const size_t first = std::stoul(range.substr(0, dash));
+                    const size_t last  = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+                    for (size_t cpu = first; cpu <= last; ++cpu)
+                        res.push_back(cpu);
+                }
+                catch (...)
+                {
+                    // skip malformed part (for example, trailing new line)
+                }
+            }
+            return res;
+        }
+
+    private:
+        static std::string read_file(const std::string& path)
+        {
+            std::ifstream file{path};
+            std::string   res{};
+            std::getline(file, res);
+            return res;
+        }
+
+        static void set_name([[maybe_unused]] const std::string& thread_name)
+        {
+#if defined(__linux__)
+            pthread_setname_np(pthread_self(), thread_name.substr(0, 15).c_str());
+#elif defined(__APPLE__)
+            pthread_setname_np(thread_name.c_str());
+#endif
+        }
+
+        static void set_affinity([[maybe_unused]] const std::vector<size_t>& cpu_set)
+        {
+#if defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (const size_t cpu : cpu_set)
+            {
+                if (cpu < CPU_SETSIZE)
+                    CPU_SET(cpu, &set);
+            }
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+        }
+
+        static void set_priority([[maybe_unused]] int nice)
+        {
+#if defined(__linux__)
+            // on linux "nice" value is per-thread attribute when applied to thread id
+            setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), nice);
+#endif
+        }
+    };
+} // namespace rpp::schedulers
@@ -12,12 +12,28 @@
 
 #include <rpp/schedulers/fwd.hpp>
 
+#if defined(RPP_SINGLE_THREADED)
+    #error "rpp::schedulers::thread_pool owns threads and can't be used with RPP_SINGLE_THREADED"
+#endif
+
 #include <rpp/schedulers/new_thread.hpp>
+#include <rpp/schedulers/thread_config.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
 
 namespace rpp::schedulers
 {
     /**
      * @brief Scheduler owning static thread pool of workers and using "some" thread from this pool on `create_worker` call
+     * @details Thread for each new worker is selected by `thread_pool::assignment_policy` provided during construction. Additionally `create_worker(key)` can be used to bind all workers with same key to the same thread.
+     * Optional `thread_config` is applied to each thread of the pool (CPU affinity, thread name, priority and etc). See `rpp::schedulers::thread_config`.
      * @warning Expected to use this scheduler as local variable to share same threads between different operators or as static variable
      *
      * @par Examples
@@ -57,8 +73,18 @@ namespace rpp::schedulers
         };
 
     public:
-        explicit thread_pool(size_t threads_count = std::thread::hardware_concurrency())
-            : m_state{std::make_shared<state>(threads_count)}
+        /**
+         * @brief Policy to select thread of the pool for each new worker
+         */
+        enum class assignment_policy
+        {
+            round_robin,         ///< threads are selected one by one
+            least_pending,       ///< thread with minimal amount of pending schedulables is selected (requires locking of queue of each thread)
+            power_of_two_choices ///< two random threads are compared and one with less amount of pending schedulables is selected
+        };
+
+        explicit thread_pool(size_t threads_count = std::thread::hardware_concurrency(), assignment_policy policy = assignment_policy::round_robin, const thread_config& config = {})
+            : m_state{std::make_shared<state>(threads_count, policy, config)}
         {
         }
 
@@ -67,23 +93,84 @@ namespace rpp::schedulers
             return rpp::schedulers::worker<worker_strategy>{m_state->get()};
         }
 
+        /**
+         * @brief Creates worker bound to the thread selected by hash of the key. As a result, all workers created for same key are executed on the same thread.
+         */
+        template<typename Key>
+            requires requires(const Key& key) { { std::hash<Key>{}(key) } -> std::convertible_to<size_t>; }
+        rpp::schedulers::worker<worker_strategy> create_worker(const Key& key) const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_state->get_by_hash(std::hash<Key>{}(key))};
+        }
+
     private:
         class state
         {
         public:
-            explicit state(size_t threads_count)
+            state(size_t threads_count, assignment_policy policy, const thread_config& config)
+                : m_policy{policy}
             {
                 threads_count = std::max(size_t{1}, threads_count);
-                workers.reserve(threads_count);
+                m_workers.reserve(threads_count);
                 for (size_t i = 0; i < threads_count; ++i)
-                    workers.emplace_back(new_thread::create_worker());
+                {
+                    if (config.is_empty())
+                        m_workers.emplace_back();
+                    else
+                        m_workers.emplace_back(config, i);
+                }
+            }
+
+            original_worker get()
+            {
+                switch (m_policy)
+                {
+                case assignment_policy::least_pending: return get_least_pending();
+                case assignment_policy::power_of_two_choices: return get_power_of_two_choices();
+                case assignment_policy::round_robin: break;
+                }
+                return original_worker{m_workers[next_index()]};
             }
 
-            const original_worker& get() { return workers[index++ % workers.size()]; }
+            original_worker get_by_hash(size_t hash) const { return original_worker{m_workers[hash % m_workers.size()]}; }
+
+        private:
+            size_t next_index() { return m_index.fetch_add(1, std::memory_order_relaxed) % m_workers.size(); }
+
+            original_worker get_least_pending()
+            {
+                // start from "next" index to spread workers between threads with equal load
+                const size_t start = next_index();
+                size_t       best  = start;
+                size_t       min   = m_workers[start].get_pending_count();
+                for (size_t i = 1; i < m_workers.size() && min != 0; ++i)
+                {
+                    const size_t index = (start + i) % m_workers.size();
+                    if (const auto count = m_workers[index].get_pending_count(); count < min)
+                    {
+                        best = index;
+                        min  = count;
+                    }
+                }
+                return original_worker{m_workers[best]};
+            }
+
+            original_worker get_power_of_two_choices()
+            {
+                if (m_workers.size() == 1)
+                    return original_worker{m_workers.front()};
+
+                static thread_local std::minstd_rand s_random{std::random_device{}()};
+
+                const size_t first  = s_random() % m_workers.size();
+                const size_t second = (first + 1 + s_random() % (m_workers.size() - 1)) % m_workers.size();
+                return original_worker{m_workers[m_workers[second].get_pending_count() < m_workers[first].get_pending_count() ? second : first]};
+            }
 
         private:
-            std::vector<original_worker> workers{};
-            size_t                       index{};
+            std::vector<new_thread::worker_strategy> m_workers{};
+            std::atomic_size_t                       m_index{};
+            const assignment_policy                  m_policy;
         };
 
         std::shared_ptr<state> m_state{};
@@ -0,0 +1,103 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/utils.hpp>
+
+#include <limits>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Budget of continuous execution of recursive schedulable (one requesting re-schedule without delay, like `from_iterable` or `repeat`) by thread of scheduler.
+     * @details Thread executes such schedulable again and again without touching queue while nobody else needs the thread. Some schedulables (for example, ones scheduled via `current_thread` from inside of the executing one) can't interrupt this loop, so long recursive schedulable monopolizes the thread and timers fire late. After exceeding of budget schedulable is re-queued, so all ready schedulables and timers are executed before it continues. Also pending delayed schedulables don't force re-queueing after each execution anymore: they are checked once per slice.
+     *
+     * - `unlimited()` - schedulable is re-queued only when thread has any other pending schedulables scheduled from other threads (default)
+     * - `items(count)` - schedulable is re-queued after `count` sequential executions
+     * - `of(duration)` - schedulable is re-queued after sequential executions during `duration` (clock is read once per 16 executions, so slice can be exceeded by duration of such batch)
+     *
+     * @par Example
+     * \code{.cpp}
+     * rpp::schedulers::thread_config config{};
+     * config.slice = rpp::schedulers::time_slice::of(std::chrono::microseconds{100});
+     * rpp::source::from_iterable(huge_vector, rpp::schedulers::thread_pool{4, rpp::schedulers::thread_pool::assignment_policy::round_robin, config}) | ...;
+     * \endcode
+     *
+     * @ingroup schedulers
+     */
+    class time_slice
+    {
+    public:
+        constexpr time_slice() = default;
+
+        /**
+         * @param max_items amount of sequential executions of schedulable
+         * @param max_duration duration of sequential executions of schedulable
+         */
+        constexpr time_slice(size_t max_items, duration max_duration)
+            : m_max_items{max_items}
+            , m_max_duration{max_duration}
+        {
+        }
+
+        static constexpr time_slice unlimited() { return time_slice{}; }
+        static constexpr time_slice items(size_t count) { return time_slice{count, duration::max()}; }
+        static constexpr time_slice of(duration duration) { return time_slice{std::numeric_limits<size_t>::max(), duration}; }
+
+        constexpr bool is_unlimited() const { return m_max_items == std::numeric_limits<size_t>::max() && m_max_duration == duration::max(); }
+
+        constexpr size_t   get_max_items() const { return m_max_items; }
+        constexpr duration get_max_duration() const { return m_max_duration; }
+
+        constexpr bool operator==(const time_slice&) const = default;
+
+    private:
+        size_t   m_max_items{std::numeric_limits<size_t>::max()};
+        duration m_max_duration{duration::max()};
+    };
+} // namespace rpp::schedulers
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Tracks consumption of `time_slice` by sequential executions of single schedulable
+     */
+    class time_slice_budget
+    {
+        static constexpr size_t clock_check_period = 16;
+
+    public:
+        explicit time_slice_budget(const time_slice& slice)
+            : m_items_left{slice.get_max_items()}
+            , m_deadline{slice.get_max_duration() == duration::max() ? time_point::max() : details::now() + slice.get_max_duration()}
+        {
+        }
+
+        /**
+         * @brief Accounts one more execution
+         * @return true if schedulable can be executed again within this slice
+         */
+        bool consume()
+        {
+            if (m_items_left <= 1)
+                return false;
+            --m_items_left;
+            return m_deadline == time_point::max() || ++m_executed % clock_check_period != 0 || details::now() < m_deadline;
+        }
+
+    private:
+        size_t     m_items_left;
+        time_point m_deadline;
+        size_t     m_executed{};
+    };
+} // namespace rpp::schedulers::details
@@ -0,0 +1,79 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/utils.hpp>
+
+#include <chrono>
+#include <optional>
+
+#if defined(__linux__)
+    #include <sys/prctl.h>
+#endif
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Precision of waiting for delayed schedulables by thread of scheduler.
+     * @details By default thread waits for timepoint of delayed schedulable via condition variable or `std::this_thread::sleep_for`. On Linux such waits routinely overshoot deadline by 50-100us due to timer slack and wake up latency.
+     *
+     * - `standard()` - OS timers are used as is (default)
+     * - `precise(spin_window)` - timer slack of thread is reduced to minimum, thread blocks till `deadline - spin_window` (via condition variable or `timerfd` with absolute deadline) and spins rest of the time checking for deadline.
+     *
+     * Setting is per-thread: it is applied by thread-owning schedulers via `rpp::schedulers::thread_config::timer` and affects all time-based waits of this thread (including `current_thread` and `immediate` schedulers used inside). To apply it to any other thread (for example, to thread draining `current_thread` queue or dispatching `run_loop`) use `apply_to_current_thread()`.
+     *
+     * @warning Each delayed schedulable costs up to `spin_window` of busy CPU time.
+     *
+     * @ingroup schedulers
+     */
+    class timer_precision
+    {
+    public:
+        static constexpr duration default_spin_window = std::chrono::microseconds{100};
+
+        constexpr timer_precision() = default;
+
+        static constexpr timer_precision standard() { return timer_precision{}; }
+        static constexpr timer_precision precise(duration spin_window = default_spin_window) { return timer_precision{spin_window}; }
+
+        constexpr bool is_precise() const { return m_spin_window.has_value(); }
+
+        constexpr std::optional<duration> get_spin_window() const { return m_spin_window; }
+
+        /**
+         * @brief Applies precision to all time-based waits of the calling thread
+         */
+        void apply_to_current_thread() const
+        {
+#if defined(__linux__)
+            // default slack is 50us which is added to each timed wait of thread. Slack can't be zero (it means "reset to default"), so use 1ns.
+            if (is_precise())
+                prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+            else if (details::s_precise_timer_spin_window)
+                prctl(PR_SET_TIMERSLACK, 0UL, 0UL, 0UL, 0UL);
+#endif
+            details::s_precise_timer_spin_window = m_spin_window;
+        }
+
+        constexpr bool operator==(const timer_precision&) const = default;
+
+    private:
+        constexpr explicit timer_precision(duration spin_window)
+            : m_spin_window{spin_window}
+        {
+        }
+
+    private:
+        std::optional<duration> m_spin_window{};
+    };
+} // namespace rpp::schedulers
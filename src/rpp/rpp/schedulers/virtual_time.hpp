@@ -0,0 +1,237 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler with virtual time for simulations and backtesting: time doesn't flow by itself and moves only when scheduler is driven via `advance_to`/`advance_by`/`run`. Each schedulable is executed with virtual time equal to its timepoint, so `delay`, `debounce`, `throttle`, `timeout`, `interval` and etc. behave exactly as in real time, but without any waiting.
+     * @details Each instance owns its own clock: creation or driving of one instance never changes time of another one. Scheduling via worker and `current_time()` of worker (used by `delay`/`debounce`/`throttle`/`timeout`) read clock of its own instance, so pass instance itself to operators (for example, `throttle(period, scheduler)`).
+     * Static `now()` of worker can't know exact instance, so it returns virtual time of the instance being driven on the calling thread right now (or time of the last driven instance outside of driving).
+     * Schedulables are kept in the same pooled heap as other schedulers without any per-event bookkeeping, so memory usage is proportional to amount of pending schedulables only.
+     *
+     * @warning Scheduler is single-threaded: all scheduling and driving is expected to happen on the same thread. Use it with pipelines which don't switch threads.
+     *
+     * @par Example
+     * \code{.cpp}
+     * const auto scheduler = rpp::schedulers::virtual_time{};
+     * historical_events | rpp::operators::debounce(std::chrono::minutes{1}, scheduler) | rpp::operators::subscribe(...);
+     * // process all events as fast as possible jumping from one timepoint to another
+     * scheduler.run();
+     * \endcode
+     *
+     * @ingroup schedulers
+     */
+    class virtual_time final
+    {
+        class worker_strategy;
+
+        class state_t
+        {
+        public:
+            explicit state_t(time_point now)
+                : m_now{now}
+            {
+            }
+
+            template<typename... Args>
+            void emplace(time_point timepoint, Args&&... args)
+            {
+                m_queue.emplace(timepoint, std::forward<Args>(args)...);
+            }
+
+            time_point get_now() const { return m_now; }
+
+            size_t get_pending_count() const { return m_queue.size(); }
+
+            std::optional<time_point> get_next_timepoint()
+            {
+                remove_disposed_from_top();
+                if (m_queue.is_empty())
+                    return std::nullopt;
+                return m_queue.top()->get_timepoint();
+            }
+
+            size_t run_until(time_point limit, size_t max_count)
+            {
+                const driving_scope scope{this};
+
+                size_t count{};
+                while (count < max_count)
+                {
+                    remove_disposed_from_top();
+                    if (m_queue.is_empty() || m_queue.top()->get_timepoint() > limit)
+                        break;
+
+                    auto top = m_queue.pop();
+                    m_now    = std::max(m_now, top->get_timepoint());
+
+                    ++count;
+                    if (const auto timepoint = (*top)())
+                        m_queue.emplace(std::max(m_now, timepoint.value()), std::move(top));
+                }
+                return count;
+            }
+
+            void set_now(time_point now)
+            {
+                const driving_scope scope{this};
+                m_now = std::max(m_now, now);
+            }
+
+            static time_point get_driven_now() { return s_driven ? s_driven->m_now : s_last_driven_now; }
+
+        private:
+            // thread-local pointer to instance driven right now is used as cache for static `now()`: static function can't know exact instance, but everything executed during driving belongs to it
+            class driving_scope
+            {
+            public:
+                explicit driving_scope(const state_t* state)
+                    : m_previous{std::exchange(s_driven, state)}
+                {
+                }
+
+                driving_scope(const driving_scope&) = delete;
+                driving_scope(driving_scope&&)      = delete;
+
+                ~driving_scope() noexcept
+                {
+                    s_last_driven_now = s_driven->m_now;
+                    s_driven          = m_previous;
+                }
+
+            private:
+                const state_t* m_previous;
+            };
+
+            void remove_disposed_from_top()
+            {
+                while (!m_queue.is_empty() && m_queue.top()->is_disposed())
+                    m_queue.pop();
+            }
+
+        private:
+            details::schedulables_queue<worker_strategy> m_queue{};
+            time_point                                   m_now;
+
+            static inline thread_local const state_t* s_driven{};
+            static inline thread_local time_point     s_last_driven_now{};
+        };
+
+        class worker_strategy
+        {
+        public:
+            worker_strategy(const std::weak_ptr<state_t>& state)
+                : m_state{state}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                if (const auto shared = m_state.lock())
+                    shared->emplace(shared->get_now() + duration, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                if (const auto shared = m_state.lock())
+                    shared->emplace(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
+
+            static rpp::schedulers::time_point now() { return state_t::get_driven_now(); }
+
+            rpp::schedulers::time_point current_time() const
+            {
+                if (const auto shared = m_state.lock())
+                    return shared->get_now();
+                return now();
+            }
+
+        private:
+            std::weak_ptr<state_t> m_state;
+        };
+
+    public:
+        /**
+         * @param start initial virtual time
+         */
+        explicit virtual_time(time_point start = {})
+            : m_state{std::make_shared<state_t>(start)}
+        {
+        }
+
+        /**
+         * @brief Current virtual time of this instance
+         */
+        time_point now() const { return m_state->get_now(); }
+
+        bool is_empty() const { return m_state->get_pending_count() == 0; }
+
+        /**
+         * @brief Amount of pending schedulables (including disposed ones not removed yet)
+         */
+        size_t pending_count() const { return m_state->get_pending_count(); }
+
+        /**
+         * @brief Timepoint of the earliest pending schedulable or nullopt if there is nothing to execute
+         */
+        std::optional<time_point> next_timepoint() const { return m_state->get_next_timepoint(); }
+
+        /**
+         * @brief Executes all schedulables with timepoint up to `timepoint` (including ones scheduled during execution) in order of their timepoints and moves virtual time to `timepoint`.
+         * @return amount of executed schedulables
+         */
+        size_t advance_to(time_point timepoint) const
+        {
+            const auto count = m_state->run_until(timepoint, std::numeric_limits<size_t>::max());
+            m_state->set_now(timepoint);
+            return count;
+        }
+
+        /**
+         * @brief Same as `advance_to(now() + duration)`
+         */
+        size_t advance_by(duration duration) const { return advance_to(now() + duration); }
+
+        /**
+         * @brief Executes pending schedulables as fast as possible jumping virtual time directly to timepoint of each next schedulable till queue becomes empty or `max_count` schedulables are executed.
+         * @warning Never returns for infinite sources (like `interval`) without `max_count`: use `advance_to` for them.
+         * @return amount of executed schedulables
+         */
+        size_t run(size_t max_count = std::numeric_limits<size_t>::max()) const
+        {
+            return m_state->run_until(time_point::max(), max_count);
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_state};
+        }
+
+    private:
+        std::shared_ptr<state_t> m_state;
+    };
+} // namespace rpp::schedulers
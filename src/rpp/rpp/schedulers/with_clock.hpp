@@ -0,0 +1,93 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/clocks.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler adaptor which uses provided clock for `now()` of workers of original scheduler. Scheduling itself is fully delegated to the original scheduler.
+     * @details Operators (`delay`, `debounce`, `timeout`, `throttle` and etc) read current time via `worker.now()` on each emission, so cheaper clock reduces per-emission overhead for high-rate streams.
+     *
+     * @tparam Clock one of `precise_clock`, `coarse_clock`, `tsc_clock`, `cached_clock` or any type with static `now()` returning `rpp::schedulers::time_point` of `clock_type`
+     *
+     * @par Example
+     * \code{.cpp}
+     * rpp::source::interval(std::chrono::milliseconds{1}, rpp::schedulers::new_thread{})
+     *  | rpp::operators::debounce(std::chrono::milliseconds{10}, rpp::schedulers::with_clock<rpp::schedulers::cached_clock, rpp::schedulers::new_thread>{});
+     * \endcode
+     *
+     * @ingroup schedulers
+     */
+    template<rpp::schedulers::constraint::clock Clock, rpp::schedulers::constraint::scheduler Scheduler>
+    class with_clock final
+    {
+        using original_worker = rpp::schedulers::utils::get_worker_t<Scheduler>;
+
+        class worker_strategy
+        {
+        public:
+            explicit worker_strategy(original_worker&& original_worker)
+                : m_original_worker{std::move(original_worker)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_original_worker.schedule(duration, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_original_worker.schedule(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, rpp::schedulers::priority priority, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_original_worker.schedule(priority, tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            auto get_disposable() const
+            {
+                if constexpr (original_worker::is_none_disposable)
+                    return rpp::schedulers::details::none_disposable{};
+                else
+                    return m_original_worker.get_disposable();
+            }
+
+            static rpp::schedulers::time_point now() { return Clock::now(); }
+
+        private:
+            original_worker m_original_worker;
+        };
+
+    public:
+        explicit with_clock(Scheduler scheduler = {})
+            : m_scheduler{std::move(scheduler)}
+        {
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_scheduler.create_worker()};
+        }
+
+    private:
+        Scheduler m_scheduler;
+    };
+} // namespace rpp::schedulers
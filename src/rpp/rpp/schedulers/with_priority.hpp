@@ -0,0 +1,90 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/worker.hpp>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler adaptor which schedules all schedulables to workers of original scheduler with provided `rpp::schedulers::priority`.
+     * @details Useful to keep time-critical operators (heartbeat `interval`, `timeout` and etc) on time when the same thread is flooded with bulk traffic (`observe_on` and etc). Re-scheduled schedulables keep their priority.
+     * Priority is ignored if original scheduler doesn't support priorities.
+     *
+     * @par Example
+     * \code{.cpp}
+     * rpp::schedulers::run_loop loop{};
+     * bulk_data | rpp::operators::observe_on(loop) | rpp::operators::subscribe(...);
+     * rpp::source::interval(std::chrono::seconds{1}, rpp::schedulers::with_priority{loop, rpp::schedulers::priority::high}) | rpp::operators::subscribe(send_heartbeat);
+     * \endcode
+     *
+     * @ingroup schedulers
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    class with_priority final
+    {
+        using original_worker = rpp::schedulers::utils::get_worker_t<Scheduler>;
+
+        class worker_strategy
+        {
+        public:
+            worker_strategy(original_worker&& original_worker, rpp::schedulers::priority priority)
+                : m_original_worker{std::move(original_worker)}
+                , m_priority{priority}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_original_worker.schedule(m_priority, duration, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_original_worker.schedule(m_priority, tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            auto get_disposable() const
+            {
+                if constexpr (original_worker::is_none_disposable)
+                    return rpp::schedulers::details::none_disposable{};
+                else
+                    return m_original_worker.get_disposable();
+            }
+
+            static rpp::schedulers::time_point now() { return original_worker::now(); }
+
+        private:
+            original_worker           m_original_worker;
+            rpp::schedulers::priority m_priority;
+        };
+
+    public:
+        explicit with_priority(Scheduler scheduler, rpp::schedulers::priority priority = rpp::schedulers::priority::high)
+            : m_scheduler{std::move(scheduler)}
+            , m_priority{priority}
+        {
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_scheduler.create_worker(), m_priority};
+        }
+
+    private:
+        Scheduler                 m_scheduler;
+        rpp::schedulers::priority m_priority;
+    };
+} // namespace rpp::schedulers
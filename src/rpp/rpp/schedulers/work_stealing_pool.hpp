@@ -0,0 +1,446 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#if defined(RPP_SINGLE_THREADED)
+    #error "rpp::schedulers::work_stealing_pool owns threads and can't be used with RPP_SINGLE_THREADED"
+#endif
+
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/utils.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/schedulers/thread_config.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler owning pool of threads where any free thread can execute schedulables of any worker.
+     *
+     * @details Each worker keeps its own queue of schedulables and this queue is executed by at most one thread at a time, so schedulables of the same worker are still executed serially and in order of their timepoints (and in FIFO order for equal timepoints).
+     * When worker has some ready schedulables, it is pushed to the deque of the scheduling thread (or to the deque of some thread in round-robin manner if scheduling happens outside of pool). Each thread processes own deque and steals workers from deques of other threads when own one is empty.
+     * As a result, one long-running schedulable blocks only its own worker, while other workers are executed by other threads of the pool (unlike `rpp::schedulers::thread_pool` where each worker is pinned to one thread forever).
+     * Optional `thread_config` is applied to each thread of the pool. See `rpp::schedulers::thread_config`.
+     *
+     * On destruction of the pool, already ready schedulables are still executed, but delayed schedulables which are not ready yet are dropped.
+     *
+     * @warning Worker can be executed by different threads of the pool over time, so schedulables of the same worker are never executed in parallel, but not guaranteed to be executed by the same thread.
+     * @warning Expected to use this scheduler as local variable to share same threads between different operators or as static variable
+     *
+     * @ingroup schedulers
+     */
+    class work_stealing_pool final
+    {
+    public:
+        class worker_strategy;
+
+    private:
+        class worker_state final
+        {
+        public:
+            worker_state() = default;
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void emplace(time_point tp, Fn&& fn, Handler&& handler, Args&&... args)
+            {
+                std::lock_guard lock{m_mutex};
+                m_queue.emplace(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            /**
+             * @brief Marks worker as "owned" by pool till next drain finishes
+             * @returns true if caller is responsible to submit this worker to the pool
+             */
+            bool try_acquire() { return !m_is_acquired.exchange(true, std::memory_order_acq_rel); }
+
+            /**
+             * @brief Executes earliest schedulable of this worker if it is ready
+             * @param resubmit_now set to true if schedulable was executed and worker is still acquired, so caller is responsible to continue its processing
+             * @returns timepoint of the earliest non-ready schedulable in case of worker released and should be re-submitted to pool at this timepoint
+             */
+            std::optional<time_point> drain(bool& resubmit_now);
+
+            /**
+             * @brief Remembers timepoint of registered timer to avoid registering of duplicates for the same queue head
+             * @returns true if timer for this timepoint is still needed
+             */
+            bool need_timer(time_point tp)
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_timer && m_timer.value() <= tp)
+                    return false;
+                m_timer = tp;
+                return true;
+            }
+
+            void on_timer(time_point tp)
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_timer == tp)
+                    m_timer.reset();
+            }
+
+        private:
+            // recursive to allow destructors of schedulables disposed during compaction of queue inside of `emplace` to schedule something to the same worker
+            std::recursive_mutex                         m_mutex{};
+            details::schedulables_queue<worker_strategy> m_queue{};
+            std::optional<time_point>                    m_timer{};
+            std::atomic_bool                             m_is_acquired{};
+        };
+
+        class shared_state final
+        {
+            // amount of schedulables of one worker executed before yielding thread to other workers
+            static constexpr size_t max_batch_size = 64;
+
+            struct local_deque
+            {
+                std::mutex                                mutex{};
+                std::deque<std::shared_ptr<worker_state>> deque{};
+            };
+
+            struct timer
+            {
+                time_point                    timepoint;
+                std::shared_ptr<worker_state> worker;
+
+                bool operator>(const timer& other) const { return timepoint > other.timepoint; }
+            };
+
+        public:
+            explicit shared_state(size_t threads_count)
+                : m_deques(threads_count)
+            {
+            }
+
+            void submit(std::shared_ptr<worker_state> worker)
+            {
+                const size_t index = s_current_pool == this ? s_current_index : m_next_deque.fetch_add(1, std::memory_order_relaxed) % m_deques.size();
+                {
+                    std::lock_guard lock{m_deques[index].mutex};
+                    m_deques[index].deque.push_back(std::move(worker));
+                }
+                m_queued.fetch_add(1, std::memory_order_seq_cst);
+
+                if (m_sleeping.load(std::memory_order_seq_cst) != 0)
+                {
+                    // lock/unlock to be sure sleeping thread is waiting on cv right now or would see updated counter
+                    {
+                        std::lock_guard lock{m_mutex};
+                    }
+                    m_cv.notify_one();
+                }
+            }
+
+            void stop()
+            {
+                // pending delayed schedulables are dropped: otherwise threads would be kept alive (and destructor of pool blocked) till the furthest timer expires
+                std::vector<timer> dropped{};
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_is_stopped = true;
+                    dropped.swap(m_timers);
+                }
+                m_cv.notify_all();
+            }
+
+            static void data_thread(std::shared_ptr<shared_state> state, size_t index)
+            {
+                s_current_pool  = state.get();
+                s_current_index = index;
+
+                const details::cached_now_loop_scope cached_now_scope{};
+                while (state->process_one(index) || state->wait_for_work())
+                {
+                }
+
+                s_current_pool = nullptr;
+            }
+
+        private:
+            bool process_one(size_t index)
+            {
+                auto worker = pop(index);
+                if (!worker)
+                    return false;
+
+                for (size_t i = 0; i < max_batch_size; ++i)
+                {
+                    bool resubmit_now{};
+                    details::invalidate_cached_now();
+                    const auto next_timepoint = worker->drain(resubmit_now);
+                    if (!resubmit_now)
+                    {
+                        if (next_timepoint)
+                            add_timer(next_timepoint.value(), std::move(worker));
+                        return true;
+                    }
+
+                    // still has ready schedulables: continue in place till some other worker waits for the thread
+                    if (m_queued.load(std::memory_order_relaxed) != 0)
+                        break;
+                }
+
+                submit(std::move(worker));
+                return true;
+            }
+
+            std::shared_ptr<worker_state> pop(size_t index)
+            {
+                if (m_queued.load(std::memory_order_seq_cst) == 0)
+                    return {};
+
+                // own deque is processed in FIFO order to keep fairness between workers, others are stolen from back
+                for (size_t i = 0; i < m_deques.size(); ++i)
+                {
+                    auto& local = m_deques[(index + i) % m_deques.size()];
+
+                    std::lock_guard lock{local.mutex};
+                    if (local.deque.empty())
+                        continue;
+
+                    std::shared_ptr<worker_state> res{};
+                    if (i == 0)
+                    {
+                        res = std::move(local.deque.front());
+                        local.deque.pop_front();
+                    }
+                    else
+                    {
+                        res = std::move(local.deque.back());
+                        local.deque.pop_back();
+                    }
+                    m_queued.fetch_sub(1, std::memory_order_seq_cst);
+                    return res;
+                }
+                return {};
+            }
+
+            void add_timer(time_point tp, std::shared_ptr<worker_state> worker)
+            {
+                if (!worker->need_timer(tp))
+                    return;
+
+                {
+                    std::lock_guard lock{m_mutex};
+                    if (m_is_stopped)
+                        return;
+
+                    m_timers.push_back(timer{tp, std::move(worker)});
+                    std::push_heap(m_timers.begin(), m_timers.end(), std::greater<>{});
+                    // new timer is not the earliest one: sleeping thread (if any) would wake up in time anyway
+                    if (m_timers.front().timepoint != tp)
+                        return;
+                }
+                m_cv.notify_one();
+            }
+
+            /**
+             * @brief Waits till some worker submitted or some timer expired
+             * @returns false in case of pool is stopped and there is no any pending work
+             */
+            bool wait_for_work()
+            {
+                std::vector<std::shared_ptr<worker_state>> expired{};
+                {
+                    std::unique_lock lock{m_mutex};
+                    m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+
+                    while (m_queued.load(std::memory_order_seq_cst) == 0)
+                    {
+                        if (!m_timers.empty())
+                        {
+                            const auto now = details::now();
+                            while (!m_timers.empty() && m_timers.front().timepoint <= now)
+                            {
+                                std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<>{});
+                                m_timers.back().worker->on_timer(m_timers.back().timepoint);
+                                expired.push_back(std::move(m_timers.back().worker));
+                                m_timers.pop_back();
+                            }
+
+                            if (!expired.empty())
+                                break;
+
+                            const auto timepoint = m_timers.front().timepoint;
+                            details::wait_until(m_cv, lock, timepoint, [&] { return m_queued.load(std::memory_order_seq_cst) != 0 || m_is_stopped || m_timers.empty() || m_timers.front().timepoint < timepoint; });
+                        }
+                        else if (m_is_stopped)
+                        {
+                            m_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+                            return false;
+                        }
+                        else
+                        {
+                            m_cv.wait(lock);
+                        }
+                    }
+                    m_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+                }
+
+                for (auto& worker : expired)
+                {
+                    if (worker->try_acquire())
+                        submit(std::move(worker));
+                }
+                return true;
+            }
+
+        private:
+            std::vector<local_deque> m_deques;
+            std::atomic_size_t       m_next_deque{};
+            std::atomic_size_t       m_queued{};
+            std::atomic_size_t       m_sleeping{};
+
+            std::mutex              m_mutex{};
+            std::condition_variable m_cv{};
+            std::vector<timer>      m_timers{};
+            bool                    m_is_stopped{};
+
+            inline static thread_local const shared_state* s_current_pool{};
+            inline static thread_local size_t              s_current_index{};
+        };
+
+        class state final
+        {
+        public:
+            state(size_t threads_count, const thread_config& config)
+                : m_shared{std::make_shared<shared_state>(std::max(size_t{1}, threads_count))}
+            {
+                threads_count = std::max(size_t{1}, threads_count);
+                m_threads.reserve(threads_count);
+                for (size_t i = 0; i < threads_count; ++i)
+                {
+                    if (config.is_empty())
+                        m_threads.emplace_back(&shared_state::data_thread, m_shared, i);
+                    else
+                        m_threads.emplace_back([shared = m_shared, config, i] {
+                            config.apply(i);
+                            shared_state::data_thread(shared, i);
+                        });
+                }
+            }
+
+            state(const state&) = delete;
+            state(state&&)      = delete;
+
+            ~state() noexcept
+            {
+                m_shared->stop();
+                for (auto& thread : m_threads)
+                {
+                    if (thread.get_id() != std::this_thread::get_id())
+                        thread.join();
+                    else
+                        thread.detach();
+                }
+            }
+
+            shared_state& get_shared() const { return *m_shared; }
+
+        private:
+            std::shared_ptr<shared_state> m_shared;
+            std::vector<std::thread>      m_threads{};
+        };
+
+    public:
+        class worker_strategy
+        {
+        public:
+            explicit worker_strategy(std::shared_ptr<state> pool_state)
+                : m_state{std::move(pool_state)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                if (handler.is_disposed())
+                    return;
+
+                m_worker->emplace(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                if (m_worker->try_acquire())
+                    m_state->get_shared().submit(m_worker);
+            }
+
+            static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
+
+            static rpp::schedulers::time_point now() { return details::now(); }
+
+        private:
+            std::shared_ptr<state>        m_state;
+            std::shared_ptr<worker_state> m_worker = std::make_shared<worker_state>();
+        };
+
+        explicit work_stealing_pool(size_t threads_count = std::thread::hardware_concurrency(), const thread_config& config = {})
+            : m_state{std::make_shared<state>(threads_count, config)}
+        {
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_state};
+        }
+
+    private:
+        std::shared_ptr<state> m_state{};
+    };
+
+    inline std::optional<time_point> work_stealing_pool::worker_state::drain(bool& resubmit_now)
+    {
+        resubmit_now = false;
+
+        // destroyed after unlocking of mutex: destructors of captured state can schedule something to this worker again
+        std::vector<details::schedulable_ptr> disposed{};
+
+        std::unique_lock lock{m_mutex};
+        while (!m_queue.is_empty() && m_queue.top()->is_disposed())
+            disposed.push_back(m_queue.pop());
+
+        if (m_queue.is_empty())
+        {
+            m_is_acquired.store(false, std::memory_order_release);
+            return std::nullopt;
+        }
+
+        if (const auto tp = m_queue.top()->get_timepoint(); tp > details::s_last_now_time && tp > details::now())
+        {
+            m_is_acquired.store(false, std::memory_order_release);
+            return tp;
+        }
+
+        auto top = m_queue.pop();
+        lock.unlock();
+
+        if (const auto res = top->make_advanced_call())
+        {
+            if (!top->is_disposed())
+            {
+                lock.lock();
+                m_queue.emplace(top->handle_advanced_call(res.value()), std::move(top));
+                lock.unlock();
+            }
+        }
+
+        resubmit_now = true;
+        return std::nullopt;
+    }
+} // namespace rpp::schedulers
@@ -16,6 +16,7 @@
 #include <rpp/observables/observable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/sources/from.hpp>
+#include <rpp/utils/utils.hpp>
 
 #include <exception>
 
@@ -42,7 +43,7 @@ namespace rpp::details
         RPP_NO_UNIQUE_ADDRESS TObserver                 observer;
         RPP_NO_UNIQUE_ADDRESS PackedContainer           container;
         std::optional<decltype(std::cbegin(container))> itr{};
-        std::atomic<bool>                               is_inside_drain{};
+        rpp::utils::atomic<bool>                        is_inside_drain{};
     };
 
     template<rpp::constraint::observer TObserver, typename PackedContainer>
@@ -53,8 +54,8 @@ namespace rpp::details
     {
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        std::shared_ptr<concat_state_t<TObserver, PackedContainer>> state{};
-        mutable bool                                                locally_disposed{};
+        rpp::disposable_ptr<concat_state_t<TObserver, PackedContainer>> state{};
+        mutable bool                                                    locally_disposed{};
 
         template<typename T>
         void on_next(T&& v) const
@@ -83,7 +84,7 @@ namespace rpp::details
     };
 
     template<rpp::constraint::observer TObserver, typename PackedContainer>
-    void drain(const std::shared_ptr<concat_state_t<TObserver, PackedContainer>>& state)
+    void drain(const rpp::disposable_ptr<concat_state_t<TObserver, PackedContainer>>& state)
     {
         while (!state->is_disposed())
         {
@@ -47,7 +47,7 @@ namespace rpp::subjects::details
         {
             using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-            std::shared_ptr<behavior_state> state;
+            rpp::disposable_ptr<behavior_state> state;
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
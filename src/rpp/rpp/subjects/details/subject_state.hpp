@@ -172,8 +172,8 @@ namespace rpp::subjects::details
         }
 
     private:
-        state_t                                                                                  m_state{};
-        std::mutex                                                                               m_mutex{};
-        RPP_NO_UNIQUE_ADDRESS std::conditional_t<Serialized, std::mutex, rpp::utils::none_mutex> m_serialized_mutex{};
+        state_t                                                                                         m_state{};
+        rpp::utils::mutex                                                                               m_mutex{};
+        RPP_NO_UNIQUE_ADDRESS std::conditional_t<Serialized, rpp::utils::mutex, rpp::utils::none_mutex> m_serialized_mutex{};
     };
 } // namespace rpp::subjects::details
@@ -25,7 +25,7 @@ namespace rpp::subjects::details
         {
             using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-            std::shared_ptr<details::subject_state<Type, Serialized>> state{};
+            rpp::disposable_ptr<details::subject_state<Type, Serialized>> state{};
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
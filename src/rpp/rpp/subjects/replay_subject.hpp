@@ -75,7 +75,7 @@ namespace rpp::subjects::details
             }
 
         private:
-            std::mutex                  m_values_mutex{};
+            rpp::utils::mutex           m_values_mutex{};
             std::deque<value_with_time> m_values{};
 
             const size_t                    m_limit;
@@ -86,7 +86,7 @@ namespace rpp::subjects::details
         {
             using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-            std::shared_ptr<replay_state> state;
+            rpp::disposable_ptr<replay_state> state;
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
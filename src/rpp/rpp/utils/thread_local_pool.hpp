@@ -0,0 +1,250 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace rpp::utils
+{
+    /**
+     * @brief Thread-local free-list allocator of memory blocks bucketed by size.
+     * @details Each block remembers pool of thread which allocated it. Block freed by the same thread is cached by this thread and re-used by the next allocation of same bucket. Block freed by any other thread is returned to owning thread via lock-free list and re-used by owning thread as soon as its own cache is empty.
+     * As a result, in steady state no any calls to global `operator new` happen even if blocks are allocated on one thread and freed on another one (for example, producer thread schedules work to `observe_on`'s worker thread).
+     * Blocks bigger than `max_block_size` are allocated directly via global `operator new`.
+     *
+     * @tparam Tag separates caches of different users of pool
+     * @tparam BlockGranularity size step between buckets
+     * @tparam BucketsCount amount of buckets
+     */
+    template<typename Tag, size_t BlockGranularity, size_t BucketsCount>
+    class thread_local_pool
+    {
+    public:
+        static constexpr size_t block_granularity = BlockGranularity;
+        static constexpr size_t buckets_count     = BucketsCount;
+        static constexpr size_t max_block_size    = block_granularity * buckets_count;
+        static constexpr size_t max_cached_blocks = 1024;
+
+        static void* allocate(size_t size)
+        {
+            if (size > max_block_size)
+                return ::operator new(size);
+
+            if (auto* const state = get_state())
+                return state->allocate(get_bucket(size));
+
+            return allocate_block(nullptr, get_bucket(size));
+        }
+
+        static void deallocate(void* ptr, size_t size) noexcept
+        {
+            if (size > max_block_size)
+                return ::operator delete(ptr, size);
+
+            auto* const owner = get_header(ptr)->owner;
+            if (!owner)
+                return free_block(ptr, get_bucket(size));
+
+            if (owner == s_current)
+                owner->push(get_bucket(size), ptr);
+            else
+                owner->push_returned(get_bucket(size), ptr);
+        }
+
+    private:
+        class pool_state;
+
+        static constexpr size_t get_bucket(size_t size) { return (size - 1) / block_granularity; }
+
+        // placed right before each block
+        struct alignas(std::max_align_t) header
+        {
+            pool_state* owner;
+        };
+
+        struct cached_block
+        {
+            cached_block* next;
+            size_t        bucket;
+        };
+
+        static_assert(sizeof(cached_block) <= block_granularity, "freed block should be able to keep cached_block");
+
+        struct bucket
+        {
+            cached_block* head{};
+            size_t        size{};
+        };
+
+        static header* get_header(void* ptr) { return static_cast<header*>(ptr) - 1; }
+
+        static void* allocate_block(pool_state* owner, size_t bucket)
+        {
+            auto* const h = ::new (::operator new(sizeof(header) + (bucket + 1) * block_granularity)) header{owner};
+            return h + 1;
+        }
+
+        static void free_block(void* ptr, size_t bucket) noexcept
+        {
+            ::operator delete(get_header(ptr), sizeof(header) + (bucket + 1) * block_granularity);
+        }
+
+        /**
+         * @brief State of pool of one thread. Kept alive by owning thread and by each block allocated from it, so blocks can be returned to it even after exit of owning thread.
+         */
+        class pool_state
+        {
+        public:
+            void* allocate(size_t index)
+            {
+                if (void* ptr = pop(index))
+                    return ptr;
+
+                take_returned();
+                if (void* ptr = pop(index))
+                    return ptr;
+
+                m_refs.fetch_add(1, std::memory_order_relaxed);
+                return allocate_block(this, index);
+            }
+
+            void push(size_t index, void* ptr) noexcept
+            {
+                auto& b = m_buckets[index];
+                if (b.size >= max_cached_blocks)
+                    return free_owned_block(ptr, index);
+
+                ++b.size;
+                b.head = ::new (ptr) cached_block{b.head, index};
+            }
+
+            // can be called from any thread
+            void push_returned(size_t index, void* ptr) noexcept
+            {
+                auto* const block = ::new (ptr) cached_block{nullptr, index};
+                auto*       head  = m_returned.load(std::memory_order_relaxed);
+                do
+                {
+                    if (head == &s_closed)
+                        return free_owned_block(ptr, index);
+
+                    block->next = head;
+                } while (!m_returned.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            // called by owning thread on its exit
+            void close() noexcept
+            {
+                for (auto& b : m_buckets)
+                    free_list(std::exchange(b.head, nullptr));
+
+                free_list(m_returned.exchange(&s_closed, std::memory_order_acquire));
+                release();
+            }
+
+        private:
+            void* pop(size_t index)
+            {
+                auto& b = m_buckets[index];
+                if (!b.head)
+                    return nullptr;
+
+                --b.size;
+                return std::exchange(b.head, b.head->next);
+            }
+
+            void take_returned() noexcept
+            {
+                if (!m_returned.load(std::memory_order_relaxed))
+                    return;
+
+                auto* block = m_returned.exchange(nullptr, std::memory_order_acquire);
+                while (block)
+                {
+                    auto* const next = block->next;
+                    push(block->bucket, block);
+                    block = next;
+                }
+            }
+
+            void free_list(cached_block* block) noexcept
+            {
+                while (block)
+                {
+                    auto* const next = block->next;
+                    free_owned_block(block, block->bucket);
+                    block = next;
+                }
+            }
+
+            void free_owned_block(void* ptr, size_t index) noexcept
+            {
+                free_block(ptr, index);
+                release();
+            }
+
+            void release() noexcept
+            {
+                if (m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    delete this;
+            }
+
+        private:
+            // owning thread + each block allocated from this pool
+            std::atomic<size_t>               m_refs{1};
+            std::atomic<cached_block*>        m_returned{};
+            std::array<bucket, buckets_count> m_buckets{};
+
+            inline static cached_block s_closed{};
+        };
+
+        class state_holder
+        {
+        public:
+            state_holder()
+                : m_state{new pool_state{}}
+            {
+                s_current = m_state;
+            }
+
+            state_holder(const state_holder&) = delete;
+            state_holder(state_holder&&)      = delete;
+
+            ~state_holder() noexcept
+            {
+                s_destroyed = true;
+                s_current   = nullptr;
+                m_state->close();
+            }
+
+            pool_state* get() const { return m_state; }
+
+        private:
+            pool_state* m_state;
+        };
+
+        static pool_state* get_state()
+        {
+            if (s_destroyed)
+                return nullptr;
+
+            static thread_local state_holder s_holder{};
+            return s_holder.get();
+        }
+
+        // trivially destructible, so still valid to check after destruction of holder (for example, blocks allocated or freed during destruction of other thread_local/static objects)
+        inline static thread_local bool        s_destroyed{};
+        inline static thread_local pool_state* s_current{};
+    };
+} // namespace rpp::utils
@@ -15,6 +15,7 @@
 #include <rpp/utils/tuple.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <mutex>
 
 namespace rpp::utils
@@ -251,9 +252,88 @@ namespace rpp::utils
     {
         static constexpr void lock() {}
         static constexpr void unlock() {}
-        static constexpr void try_lock() {}
+        static constexpr bool try_lock() { return true; }
     };
 
+    /**
+     * @brief True if library is compiled in single-threaded mode (`RPP_SINGLE_THREADED` is defined)
+     */
+#if defined(RPP_SINGLE_THREADED)
+    inline constexpr bool is_single_threaded = true;
+#else
+    inline constexpr bool is_single_threaded = false;
+#endif
+
+    /**
+     * @brief Same interface as `std::atomic`, but without any atomicity: used in single-threaded mode. Memory orders are ignored.
+     */
+    template<typename T>
+    class non_atomic
+    {
+    public:
+        constexpr non_atomic() = default;
+
+        constexpr non_atomic(T value) noexcept
+            : m_value{value}
+        {
+        }
+
+        non_atomic(const non_atomic&)            = delete;
+        non_atomic& operator=(const non_atomic&) = delete;
+
+        T    load(std::memory_order = std::memory_order::seq_cst) const noexcept { return m_value; }
+        void store(T value, std::memory_order = std::memory_order::seq_cst) noexcept { m_value = value; }
+
+        T exchange(T value, std::memory_order = std::memory_order::seq_cst) noexcept { return std::exchange(m_value, value); }
+
+        bool compare_exchange_strong(T& expected, T desired, std::memory_order = std::memory_order::seq_cst, std::memory_order = std::memory_order::seq_cst) noexcept
+        {
+            if (m_value == expected)
+            {
+                m_value = desired;
+                return true;
+            }
+            expected = m_value;
+            return false;
+        }
+
+        bool compare_exchange_weak(T& expected, T desired, std::memory_order success = std::memory_order::seq_cst, std::memory_order failure = std::memory_order::seq_cst) noexcept
+        {
+            return compare_exchange_strong(expected, desired, success, failure);
+        }
+
+        T fetch_add(T value, std::memory_order = std::memory_order::seq_cst) noexcept
+            requires std::is_integral_v<T>
+        {
+            return std::exchange(m_value, m_value + value);
+        }
+
+        T fetch_sub(T value, std::memory_order = std::memory_order::seq_cst) noexcept
+            requires std::is_integral_v<T>
+        {
+            return std::exchange(m_value, m_value - value);
+        }
+
+        // nobody else can change value while we are waiting
+        void wait(T, std::memory_order = std::memory_order::seq_cst) const noexcept {}
+        void notify_one() noexcept {}
+        void notify_all() noexcept {}
+
+    private:
+        T m_value{};
+    };
+
+    /**
+     * @brief `std::atomic` or `rpp::utils::non_atomic` in single-threaded mode
+     */
+    template<typename T>
+    using atomic = std::conditional_t<is_single_threaded, non_atomic<T>, std::atomic<T>>;
+
+    /**
+     * @brief `std::mutex` or `rpp::utils::none_mutex` in single-threaded mode
+     */
+    using mutex = std::conditional_t<is_single_threaded, none_mutex, std::mutex>;
+
     template<typename T>
     class value_with_mutex
     {
@@ -281,7 +361,7 @@ namespace rpp::utils
             }
 
         private:
-            pointer_under_lock(T& val, std::mutex& mutex)
+            pointer_under_lock(T& val, rpp::utils::mutex& mutex)
                 : m_ptr{&val}
                 , m_lock{mutex}
             {
@@ -295,18 +375,18 @@ namespace rpp::utils
             const T& operator*() const { return *m_ptr; }
 
         private:
-            T*                           m_ptr;
-            std::scoped_lock<std::mutex> m_lock;
+            T*                                  m_ptr;
+            std::scoped_lock<rpp::utils::mutex> m_lock;
         };
 
         pointer_under_lock lock() { return *this; }
 
-        std::mutex& get_mutex() { return m_mutex; }
-        T&          get_value_unsafe() { return m_value; }
+        rpp::utils::mutex& get_mutex() { return m_mutex; }
+        T&                 get_value_unsafe() { return m_value; }
 
     private:
-        T          m_value{};
-        std::mutex m_mutex{};
+        T                 m_value{};
+        rpp::utils::mutex m_mutex{};
     };
 
     template<typename T>
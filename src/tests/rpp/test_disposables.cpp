@@ -9,10 +9,16 @@
 
 #include <snitch/snitch.hpp>
 
+#include <rpp/disposables/callback_disposable.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/refcount_disposable.hpp>
 
+#include <algorithm>
+#include <optional>
+#include <thread>
+#include <vector>
+
 namespace
 {
     struct custom_disposable : public rpp::interface_disposable
@@ -27,7 +33,7 @@ namespace
     };
 } // namespace
 
-TEMPLATE_TEST_CASE("disposable keeps state", "", rpp::details::disposables::dynamic_disposables_container<0>, rpp::details::disposables::static_disposables_container<1>)
+TEMPLATE_TEST_CASE("disposable keeps state", "", rpp::details::disposables::dynamic_disposables_container<0>, rpp::details::disposables::static_disposables_container<1>, rpp::details::disposables::indexed_disposables_container)
 {
     auto d = rpp::composite_disposable_wrapper::make<rpp::composite_disposable_impl<TestType>>();
 
@@ -192,6 +198,67 @@ TEMPLATE_TEST_CASE("disposable keeps state", "", rpp::details::disposables::dyna
     }
 }
 
+TEST_CASE("disposable_wrapper keeps strong and weak references")
+{
+    static_assert(sizeof(rpp::disposable_wrapper) == sizeof(void*));
+    static_assert(sizeof(rpp::composite_disposable_wrapper) == sizeof(void*));
+
+    auto strong = rpp::disposable_wrapper_impl<custom_disposable>::make();
+    auto weak   = strong.as_weak();
+
+    CHECK(strong == weak);
+    CHECK(strong.lock().use_count() == 2);
+    CHECK(weak.lock().get() == strong.lock().get());
+
+    SECTION("weak wrapper doesn't prolong lifetime")
+    {
+        const rpp::disposable_wrapper weak_base = weak;
+        strong                                  = rpp::disposable_wrapper_impl<custom_disposable>::empty();
+
+        CHECK(!weak.lock());
+        CHECK(weak.is_disposed());
+        CHECK(weak_base.is_disposed());
+        CHECK(weak == rpp::disposable_wrapper_impl<custom_disposable>::empty());
+        weak.dispose();
+    }
+
+    SECTION("locked pointer prolongs lifetime")
+    {
+        auto locked = weak.lock();
+        strong      = rpp::disposable_wrapper_impl<custom_disposable>::empty();
+
+        CHECK(locked->dispose_count == 0);
+        CHECK(!weak.is_disposed());
+        CHECK(weak.lock() == locked);
+
+        locked = nullptr;
+        CHECK(!weak.lock());
+    }
+
+    SECTION("disposable is disposed on destruction of last strong reference")
+    {
+        auto composite = rpp::composite_disposable_wrapper::make();
+        auto child     = rpp::composite_disposable_wrapper::make();
+        composite.add(child);
+        composite = rpp::composite_disposable_wrapper::empty();
+
+        CHECK(child.is_disposed());
+    }
+
+    SECTION("disposable is kept alive during dispose even if its last owner is released by child")
+    {
+        auto holder = std::make_optional(rpp::composite_disposable_wrapper::make());
+        auto last   = rpp::composite_disposable_wrapper::make();
+
+        holder->add(rpp::make_callback_disposable([&holder]() noexcept { holder.reset(); }));
+        holder->add(last);
+        holder->dispose();
+
+        CHECK(!holder.has_value());
+        CHECK(last.is_disposed());
+    }
+}
+
 TEST_CASE("refcount disposable dispose underlying in case of reaching zero")
 {
     auto refcount   = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
@@ -267,6 +334,80 @@ TEST_CASE("refcount disposable dispose underlying in case of reaching zero")
     }
 }
 
+TEST_CASE("refcount disposable disposes its references")
+{
+    auto refcount = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+
+    std::vector<rpp::composite_disposable_wrapper>                refs{};
+    std::vector<rpp::disposable_wrapper_impl<custom_disposable>> inner{};
+    for (size_t i = 0; i < 5; ++i)
+    {
+        refs.push_back(refcount.lock()->add_ref());
+        inner.push_back(rpp::disposable_wrapper_impl<custom_disposable>::make());
+        refs.back().add(inner.back());
+    }
+
+    SECTION("disposing of reference in the middle keeps others")
+    {
+        refs[2].dispose();
+        refs[2] = rpp::composite_disposable_wrapper::empty();
+        CHECK(inner[2].lock()->dispose_count == 1);
+        CHECK(!refcount.is_disposed());
+
+        refcount.dispose();
+        for (size_t i = 0; i < refs.size(); ++i)
+        {
+            CHECK(refs[i].is_disposed());
+            CHECK(inner[i].lock()->dispose_count == 1);
+        }
+    }
+
+    SECTION("references kept alive by others are disposed even if only weak ones are kept by user")
+    {
+        // first references are kept by user directly, rest ones - only by some other owner
+        auto                                           owner = rpp::composite_disposable_wrapper::make();
+        std::vector<rpp::composite_disposable_wrapper> weak{};
+        for (size_t i = 3; i < refs.size(); ++i)
+        {
+            owner.add(refs[i]);
+            weak.push_back(refs[i].as_weak());
+        }
+        refs.resize(3);
+
+        for (const auto& w : weak)
+            CHECK(!w.is_disposed());
+
+        refcount.dispose();
+        for (const auto& ref : refs)
+            CHECK(ref.is_disposed());
+        for (const auto& w : weak)
+            CHECK(w.is_disposed());
+        for (const auto& d : inner)
+            CHECK(d.lock()->dispose_count == 1);
+        CHECK(!owner.is_disposed());
+    }
+}
+
+TEST_CASE("refcount disposable handles concurrent add_ref and dispose")
+{
+    for (size_t attempt = 0; attempt < 100; ++attempt)
+    {
+        auto refcount = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+        auto keeper   = refcount.lock()->add_ref();
+
+        std::vector<rpp::composite_disposable_wrapper> refs{};
+        std::thread                                    t{[&] {
+            for (size_t i = 0; i < 100; ++i)
+                refs.push_back(refcount.lock()->add_ref());
+        }};
+        refcount.dispose();
+        t.join();
+
+        for (const auto& ref : refs)
+            CHECK(ref.is_disposed());
+    }
+}
+
 TEST_CASE("composite_disposable correctly handles exception")
 {
     auto d  = rpp::composite_disposable_wrapper::make<rpp::composite_disposable_impl<rpp::details::disposables::static_disposables_container<1>>>();
@@ -370,3 +511,84 @@ TEST_CASE("static_disposable_container works as expected")
         }
     }
 }
+
+TEST_CASE("indexed_disposables_container removes disposables in any order")
+{
+    rpp::details::disposables::indexed_disposables_container container{};
+
+    std::vector<rpp::composite_disposable_wrapper> disposables{};
+    for (size_t i = 0; i < 100; ++i)
+    {
+        disposables.push_back(rpp::composite_disposable_wrapper::make());
+        container.push_back(disposables.back());
+    }
+    // duplicates are removed together
+    container.push_back(disposables[42]);
+
+    std::vector<size_t> removed{};
+    for (size_t i = 0; i < disposables.size(); i += 3)
+    {
+        container.remove(disposables[i]);
+        removed.push_back(i);
+    }
+    for (size_t i = 1; i < disposables.size(); i += 7)
+    {
+        const auto index = disposables.size() - i;
+        if (std::find(removed.begin(), removed.end(), index) == removed.end())
+        {
+            container.remove(disposables[index]);
+            removed.push_back(index);
+        }
+    }
+    container.remove(disposables[42]);
+    removed.push_back(42);
+    // removing of absent one is no-op
+    container.remove(rpp::composite_disposable_wrapper::make());
+
+    container.dispose();
+    for (size_t i = 0; i < disposables.size(); ++i)
+        CHECK(disposables[i].is_disposed() == (std::find(removed.begin(), removed.end(), i) == removed.end()));
+
+    SECTION("container can be reused after clear")
+    {
+        container.clear();
+        auto d = rpp::composite_disposable_wrapper::make();
+        container.push_back(d);
+        container.dispose();
+        CHECK(d.is_disposed());
+    }
+}
+
+TEST_CASE("composite_disposable handles concurrent add and remove")
+{
+    auto composite = rpp::composite_disposable_wrapper::make();
+
+    constexpr size_t threads_count = 4;
+    constexpr size_t per_thread    = 1'000;
+
+    std::vector<std::vector<rpp::composite_disposable_wrapper>> kept(threads_count);
+    std::vector<std::thread>                                    threads{};
+    for (size_t t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < per_thread; ++i)
+            {
+                auto d = rpp::composite_disposable_wrapper::make();
+                composite.add(d);
+                if (i % 2 == 0)
+                    composite.remove(d);
+                else
+                    kept[t].push_back(d);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    composite.dispose();
+    for (const auto& disposables : kept)
+    {
+        for (const auto& d : disposables)
+            CHECK(d.is_disposed());
+    }
+}
@@ -0,0 +1,159 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/memory_model.hpp>
+#include <rpp/observables/dynamic_observable.hpp>
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/delay.hpp>
+#include <rpp/operators/merge.hpp>
+#include <rpp/schedulers/virtual_time.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "snitch_logging.hpp"
+
+#include <array>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct big_disposable : public rpp::composite_disposable
+    {
+        std::array<char, 10'000> data{};
+    };
+} // namespace
+
+TEST_CASE("use_arena allocates states from one region")
+{
+    CHECK(rpp::details::arena::current() == nullptr);
+
+    SECTION("states created inside of scope are placed one after another")
+    {
+        rpp::composite_disposable_wrapper first{};
+        rpp::composite_disposable_wrapper second{};
+        {
+            const rpp::memory_model::use_arena arena{};
+            CHECK(rpp::details::arena::current() != nullptr);
+
+            first  = rpp::composite_disposable_wrapper::make();
+            second = rpp::composite_disposable_wrapper::make();
+        }
+        CHECK(rpp::details::arena::current() == nullptr);
+
+        const auto distance = static_cast<const char*>(second.get_id()) - static_cast<const char*>(first.get_id());
+        CHECK(distance > 0);
+        CHECK(distance < 256);
+
+        first.add(second);
+        first.dispose();
+        CHECK(second.is_disposed());
+    }
+
+    SECTION("nested scope replaces outer one till its end")
+    {
+        const rpp::memory_model::use_arena outer{};
+        const auto*                        outer_arena = rpp::details::arena::current();
+        {
+            const rpp::memory_model::use_arena inner{};
+            CHECK(rpp::details::arena::current() != outer_arena);
+        }
+        CHECK(rpp::details::arena::current() == outer_arena);
+    }
+
+    SECTION("states bigger than chunk are supported")
+    {
+        const rpp::memory_model::use_arena arena{64};
+
+        auto small = rpp::composite_disposable_wrapper::make();
+        auto big   = rpp::composite_disposable_wrapper::make<big_disposable>();
+        small.add(big);
+        small.dispose();
+        CHECK(big.is_disposed());
+    }
+
+    SECTION("composite created inside of scope can grow from other thread during and after scope")
+    {
+        std::vector<rpp::composite_disposable_wrapper> children{};
+        rpp::composite_disposable_wrapper              composite{};
+        {
+            const rpp::memory_model::use_arena arena{};
+            composite = rpp::composite_disposable_wrapper::make();
+
+            std::vector<rpp::composite_disposable_wrapper> other_states{};
+            std::thread                                    t{[&] {
+                for (size_t i = 0; i < 1000; ++i)
+                {
+                    children.push_back(rpp::composite_disposable_wrapper::make());
+                    composite.add(children.back());
+                }
+            }};
+            // scope thread keeps allocating from arena in parallel
+            for (size_t i = 0; i < 1000; ++i)
+                other_states.push_back(rpp::composite_disposable_wrapper::make());
+            t.join();
+        }
+
+        std::thread{[&] {
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                children.push_back(rpp::composite_disposable_wrapper::make());
+                composite.add(children.back());
+            }
+            for (size_t i = 0; i < children.size(); i += 2)
+                composite.remove(children[i]);
+        }}.join();
+
+        composite.dispose();
+        for (size_t i = 0; i < children.size(); ++i)
+            CHECK(children[i].is_disposed() == (i % 2 == 1));
+    }
+
+    SECTION("states can outlive scope and be destroyed from other thread")
+    {
+        auto d = [] {
+            const rpp::memory_model::use_arena arena{};
+            return rpp::composite_disposable_wrapper::make();
+        }();
+
+        std::thread{[d = std::move(d)]() mutable {
+            d.dispose();
+            d = rpp::composite_disposable_wrapper::empty();
+        }}.join();
+    }
+}
+
+TEST_CASE("use_arena keeps subscription working after end of scope")
+{
+    const auto                          scheduler = rpp::schedulers::virtual_time{};
+    rpp::subjects::publish_subject<int> first{};
+    rpp::subjects::publish_subject<int> second{};
+    auto                                mock = mock_observer_strategy<int>{};
+
+    {
+        const rpp::memory_model::use_arena arena{};
+
+        rpp::dynamic_observable<int>{first.get_observable()}
+            | rpp::operators::merge_with(second.get_observable())
+            | rpp::operators::delay(std::chrono::seconds{1}, scheduler)
+            | rpp::operators::subscribe(mock.get_observer().as_dynamic());
+    }
+
+    first.get_observer().on_next(1);
+    second.get_observer().on_next(2);
+    first.get_observer().on_completed();
+    second.get_observer().on_completed();
+    scheduler.run();
+
+    CHECK(mock.get_received_values() == std::vector{1, 2});
+    CHECK(mock.get_on_completed_count() == 1);
+}
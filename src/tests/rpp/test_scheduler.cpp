@@ -15,23 +15,62 @@
 #include <rpp/observers/lambda_observer.hpp>
 #include <rpp/observers/mock_observer.hpp>
 #include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/debounce.hpp>
+#include <rpp/operators/delay.hpp>
 #include <rpp/operators/subscribe_on.hpp>
+#include <rpp/operators/throttle.hpp>
+#include <rpp/operators/timeout.hpp>
 #include <rpp/schedulers.hpp>
 #include <rpp/schedulers/test_scheduler.hpp>
 #include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
 
 #include "rpp/disposables/fwd.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
 #include <future>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <new>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <vector>
+
+#if defined(__linux__)
+    #include <poll.h>
+#endif
 
 using namespace std::string_literals;
 
+// counts calls to global operator new made by current thread to check that pools keep scheduling allocation-free
+static thread_local size_t s_allocations_count{};
+
+void* operator new(size_t size)
+{
+    ++s_allocations_count;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
 static std::string get_thread_id_as_string(std::thread::id id = std::this_thread::get_id())
 {
     std::stringstream ss;
@@ -366,7 +405,7 @@ TEMPLATE_TEST_CASE("queue_based scheduler", "", rpp::schedulers::current_thread,
     auto done = std::make_shared<std::atomic_bool>();
 
     worker->schedule([&](const auto&) {
-        thread_of_schedule_promise.set_value(get_thread_id_as_string(std::this_thread::get_id()));
+        // capture `done` before setting promise: test body can finish (and destroy `done`) right after it
         if constexpr (std::same_as<TestType, rpp::schedulers::new_thread>)
             thread_local rpp::utils::finally_action a{[done] {
                 done->store(true);
@@ -374,6 +413,7 @@ TEMPLATE_TEST_CASE("queue_based scheduler", "", rpp::schedulers::current_thread,
         else
             done->store(true);
 
+        thread_of_schedule_promise.set_value(get_thread_id_as_string(std::this_thread::get_id()));
         return rpp::schedulers::optional_delay_from_now{};
     },
                      obs.value());
@@ -858,6 +898,161 @@ TEST_CASE("run_loop scheduler dispatches tasks only manually")
     }
 }
 
+TEST_CASE("run_loop dispatch_batch executes ready schedulables with budgets")
+{
+    auto scheduler = rpp::schedulers::run_loop{};
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    auto worker    = scheduler.create_worker();
+
+    std::vector<int> executions{};
+    const auto       schedule = [&](int v, rpp::schedulers::duration delay = {}) {
+        worker.schedule(delay, [&executions, v](const auto&) {
+            executions.push_back(v);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+    };
+
+    SECTION("empty run_loop")
+    {
+        const auto res = scheduler.dispatch_batch();
+        CHECK(res.executed_count == 0);
+        CHECK(!res.next_timepoint.has_value());
+    }
+
+    SECTION("all ready schedulables are executed in order, delayed one is reported as next timepoint")
+    {
+        for (int i = 0; i < 5; ++i)
+            schedule(i);
+        schedule(100, std::chrono::hours{1});
+
+        const auto res = scheduler.dispatch_batch();
+        CHECK(res.executed_count == 5);
+        CHECK(executions == std::vector{0, 1, 2, 3, 4});
+        REQUIRE(res.next_timepoint.has_value());
+        CHECK(res.next_timepoint.value() > rpp::schedulers::clock_type::now() + std::chrono::minutes{59});
+    }
+
+    SECTION("max_items limits amount of executed schedulables")
+    {
+        for (int i = 0; i < 5; ++i)
+            schedule(i);
+
+        CHECK(scheduler.dispatch_batch(3).executed_count == 3);
+        CHECK(executions == std::vector{0, 1, 2});
+
+        const auto res = scheduler.dispatch_batch(3);
+        CHECK(res.executed_count == 2);
+        CHECK(executions == std::vector{0, 1, 2, 3, 4});
+        CHECK(!res.next_timepoint.has_value());
+    }
+
+    SECTION("time budget leaves remaining schedulables in queue in same order")
+    {
+        for (int i = 0; i < 5; ++i)
+        {
+            worker.schedule([&executions, i](const auto&) {
+                executions.push_back(i);
+                std::this_thread::sleep_for(std::chrono::milliseconds{5});
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+        }
+
+        const auto res = scheduler.dispatch_batch(std::numeric_limits<size_t>::max(), std::chrono::milliseconds{1});
+        CHECK(res.executed_count == 1);
+        REQUIRE(res.next_timepoint.has_value());
+        CHECK(res.next_timepoint.value() <= rpp::schedulers::clock_type::now());
+
+        while (!scheduler.is_empty())
+            scheduler.dispatch_batch();
+        CHECK(executions == std::vector{0, 1, 2, 3, 4});
+    }
+
+    SECTION("re-scheduled schedulable is executed by next batch")
+    {
+        worker.schedule([&executions](const auto&) {
+            executions.push_back(static_cast<int>(executions.size()));
+            if (executions.size() == 3)
+                return rpp::schedulers::optional_delay_from_now{};
+            return rpp::schedulers::optional_delay_from_now{std::chrono::nanoseconds{}};
+        },
+                        obs);
+
+        CHECK(scheduler.dispatch_batch().executed_count == 1);
+        CHECK(scheduler.dispatch_batch().executed_count == 1);
+        CHECK(scheduler.dispatch_batch().executed_count == 1);
+        CHECK(scheduler.dispatch_batch().executed_count == 0);
+        CHECK(executions == std::vector{0, 1, 2});
+    }
+}
+
+#if defined(__linux__)
+TEST_CASE("run_loop fd becomes readable when schedulable is ready")
+{
+    auto scheduler = rpp::schedulers::run_loop{};
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    auto worker    = scheduler.create_worker();
+
+    size_t     executions{};
+    const auto schedule = [&](rpp::schedulers::duration delay = {}) {
+        worker.schedule(delay, [&executions](const auto&) {
+            ++executions;
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+    };
+
+    const auto is_readable = [&](std::chrono::milliseconds timeout = {}) {
+        pollfd fd{scheduler.get_fd(), POLLIN, 0};
+        return poll(&fd, 1, static_cast<int>(timeout.count())) == 1;
+    };
+
+    SECTION("fd created after scheduling is readable")
+    {
+        schedule();
+        CHECK(is_readable());
+    }
+
+    SECTION("zero-delay schedulable makes fd readable, dispatch clears it")
+    {
+        CHECK(!is_readable());
+        schedule();
+        CHECK(is_readable());
+
+        scheduler.dispatch_batch();
+        CHECK(executions == 1);
+        CHECK(!is_readable());
+    }
+
+    SECTION("fd becomes readable when delayed schedulable is ready")
+    {
+        CHECK(!is_readable());
+        schedule(std::chrono::milliseconds{20});
+        CHECK(!is_readable());
+
+        CHECK(is_readable(std::chrono::seconds{1}));
+        scheduler.dispatch_batch();
+        CHECK(executions == 1);
+        CHECK(!is_readable());
+    }
+
+    SECTION("earlier schedulable re-arms fd")
+    {
+        schedule(std::chrono::hours{1});
+        CHECK(!is_readable());
+
+        schedule();
+        CHECK(is_readable());
+
+        scheduler.dispatch_if_ready();
+        CHECK(executions == 1);
+        CHECK(!is_readable());
+        CHECK(!scheduler.is_empty());
+    }
+}
+#endif
+
 TEST_CASE("different delaying strategies")
 {
     test_scheduler scheduler{};
@@ -946,6 +1141,56 @@ TEST_CASE("current_thread inside new_thread")
     CHECK(current_thread_invoked->load());
 }
 
+TEST_CASE("cached_new_thread re-uses threads of disposed workers")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::cached_new_thread{};
+
+    const auto get_thread_id = [&obs](const auto& worker) {
+        std::promise<std::thread::id> promise{};
+        worker.schedule([&promise](const auto&) {
+            promise.set_value(std::this_thread::get_id());
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        return promise.get_future().get();
+    };
+
+    SECTION("alive workers use different threads")
+    {
+        const auto worker_1 = scheduler.create_worker();
+        const auto worker_2 = scheduler.create_worker();
+        CHECK(get_thread_id(worker_1) != get_thread_id(worker_2));
+        CHECK(get_thread_id(worker_1) != std::this_thread::get_id());
+    }
+
+    SECTION("thread of disposed worker is used by next worker")
+    {
+        auto       worker_1 = scheduler.create_worker();
+        const auto thread_1 = get_thread_id(worker_1);
+        worker_1.get_disposable().dispose();
+
+        const auto worker_2 = scheduler.create_worker();
+        CHECK(get_thread_id(worker_2) == thread_1);
+    }
+
+    SECTION("disposing of worker waits till all schedulables processed")
+    {
+        auto worker = scheduler.create_worker();
+
+        std::atomic_bool done{};
+        worker.schedule(std::chrono::milliseconds{50}, [&done](const auto&) {
+            done.store(true);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        worker.get_disposable().dispose();
+
+        CHECK(done.load());
+    }
+}
+
 TEST_CASE("thread_pool uses multiple threads")
 {
     auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
@@ -1003,3 +1248,1791 @@ TEST_CASE("thread_pool shares same thread")
 
     CHECK(f.get());
 }
+
+TEST_CASE("thread_pool assignment policies")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    const auto get_thread_id = [&obs](const auto& worker) {
+        std::promise<std::thread::id> promise{};
+        worker.schedule([&promise](const auto&) {
+            promise.set_value(std::this_thread::get_id());
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        return promise.get_future().get();
+    };
+
+    // busy thread keeps one more pending schedulable: idle thread can still be finishing schedulable of `get_thread_id` (and be counted as pending) when next worker is created
+    const auto block_thread = [&obs](const auto& worker, const std::atomic_bool& unblock) {
+        std::promise<std::thread::id> promise{};
+        worker.schedule([&promise, &unblock](const auto&) {
+            promise.set_value(std::this_thread::get_id());
+            while (!unblock)
+                std::this_thread::yield();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        worker.schedule([](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        return promise.get_future().get();
+    };
+
+    SECTION("create_worker with same key uses same thread")
+    {
+        auto scheduler = rpp::schedulers::thread_pool{4};
+
+        const auto thread_1 = get_thread_id(scheduler.create_worker(1));
+        const auto thread_2 = get_thread_id(scheduler.create_worker(2));
+        CHECK(thread_1 != thread_2);
+
+        for (size_t i = 0; i < 5; ++i)
+        {
+            scheduler.create_worker();
+            CHECK(get_thread_id(scheduler.create_worker(1)) == thread_1);
+            CHECK(get_thread_id(scheduler.create_worker(2)) == thread_2);
+        }
+    }
+
+    for (const auto policy : {rpp::schedulers::thread_pool::assignment_policy::least_pending, rpp::schedulers::thread_pool::assignment_policy::power_of_two_choices})
+    {
+        SECTION("load-aware policy doesn't select busy thread")
+        {
+            auto scheduler = rpp::schedulers::thread_pool{2, policy};
+
+            std::atomic_bool unblock{};
+            const auto       busy_thread = block_thread(scheduler.create_worker(), unblock);
+
+            for (size_t i = 0; i < 5; ++i)
+                CHECK(get_thread_id(scheduler.create_worker()) != busy_thread);
+
+            unblock.store(true);
+        }
+    }
+
+    SECTION("concurrent create_worker calls")
+    {
+        auto scheduler = rpp::schedulers::thread_pool{3};
+
+        std::vector<std::thread> threads{};
+        for (size_t i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&] {
+                for (size_t j = 0; j < 1000; ++j)
+                    scheduler.create_worker();
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+
+        CHECK(get_thread_id(scheduler.create_worker()) != get_thread_id(scheduler.create_worker()));
+    }
+}
+
+TEST_CASE("thread_config is applied to threads of schedulers")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::mutex          mutex{};
+    std::vector<size_t> indices{};
+
+    rpp::schedulers::thread_config config{};
+    config.name            = "rpp-test";
+    config.on_thread_start = [&](size_t index) {
+        std::lock_guard lock{mutex};
+        indices.push_back(index);
+    };
+
+    const auto get_thread_name = [&obs](const auto& worker) {
+        std::promise<std::string> promise{};
+        worker.schedule([&promise](const auto&) {
+            std::string name{};
+#if defined(__linux__)
+            char buffer[16]{};
+            pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+            name = buffer;
+#endif
+            promise.set_value(name);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        return promise.get_future().get();
+    };
+
+    const auto check_name = [](const std::string& name, [[maybe_unused]] const std::string& expected) {
+#if defined(__linux__)
+        CHECK(name == expected);
+#endif
+    };
+
+    SECTION("thread_pool")
+    {
+        auto scheduler = rpp::schedulers::thread_pool{2, rpp::schedulers::thread_pool::assignment_policy::round_robin, config};
+
+        check_name(get_thread_name(scheduler.create_worker()), "rpp-test-0");
+        check_name(get_thread_name(scheduler.create_worker()), "rpp-test-1");
+
+        std::lock_guard lock{mutex};
+        std::sort(indices.begin(), indices.end());
+        CHECK(indices == std::vector<size_t>{0, 1});
+    }
+
+    SECTION("work_stealing_pool")
+    {
+        {
+            auto scheduler = rpp::schedulers::work_stealing_pool{2, config};
+            CHECK(get_thread_name(scheduler.create_worker()).starts_with("rpp-test-"));
+        }
+
+        std::lock_guard lock{mutex};
+        std::sort(indices.begin(), indices.end());
+        CHECK(indices == std::vector<size_t>{0, 1});
+    }
+
+    SECTION("new_thread")
+    {
+        check_name(get_thread_name(rpp::schedulers::new_thread::create_worker(config)), "rpp-test-0");
+
+        std::lock_guard lock{mutex};
+        CHECK(indices == std::vector<size_t>{0});
+    }
+
+    SECTION("cached_new_thread applies config once per thread")
+    {
+        auto scheduler = rpp::schedulers::cached_new_thread{std::chrono::seconds{60}, 1, config};
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            auto worker = scheduler.create_worker();
+            check_name(get_thread_name(worker), "rpp-test-0");
+            worker.get_disposable().dispose();
+        }
+
+        std::lock_guard lock{mutex};
+        CHECK(indices == std::vector<size_t>{0});
+    }
+}
+
+TEST_CASE("thread_config utilities")
+{
+    SECTION("parse_cpu_list")
+    {
+        CHECK(rpp::schedulers::thread_config::parse_cpu_list("0-3,8,10-11\n") == std::vector<size_t>{0, 1, 2, 3, 8, 10, 11});
+        CHECK(rpp::schedulers::thread_config::parse_cpu_list("") == std::vector<size_t>{});
+    }
+
+    SECTION("computational can't be configured after first use")
+    {
+        rpp::schedulers::computational::create_worker();
+        CHECK(!rpp::schedulers::computational::configure(2));
+    }
+}
+
+TEST_CASE("idle strategies")
+{
+    SECTION("wait semantics")
+    {
+        size_t     calls{};
+        const auto never_ready = [&calls] {
+            ++calls;
+            return false;
+        };
+
+        CHECK(!rpp::schedulers::idle_strategy::blocking().wait(never_ready));
+        CHECK(calls == 0);
+
+        CHECK(!rpp::schedulers::idle_strategy::spin_then_park(10).wait(never_ready));
+        CHECK(calls == 11);
+
+        calls = 0;
+        CHECK(rpp::schedulers::idle_strategy::spin_then_yield(10).wait([&calls] { return ++calls == 20; }));
+        CHECK(rpp::schedulers::idle_strategy::busy_spin().wait([&calls] { return ++calls == 100; }));
+    }
+
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    for (const auto idle : {rpp::schedulers::idle_strategy::blocking(), rpp::schedulers::idle_strategy::busy_spin(), rpp::schedulers::idle_strategy::spin_then_yield(), rpp::schedulers::idle_strategy::spin_then_park(10)})
+    {
+        SECTION("new_thread processes zero-delay and delayed schedulables and disposes with any strategy")
+        {
+            rpp::schedulers::thread_config config{};
+            config.idle = idle;
+
+            auto worker = rpp::schedulers::new_thread::create_worker(config);
+            for (const auto delay : {rpp::schedulers::duration{}, rpp::schedulers::duration{std::chrono::milliseconds{5}}})
+            {
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    std::promise<void> promise{};
+                    worker.schedule(delay, [&promise](const auto&) {
+                        promise.set_value();
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                    obs);
+                    CHECK(promise.get_future().wait_for(std::chrono::seconds{1}) == std::future_status::ready);
+                }
+            }
+            worker.get_disposable().dispose();
+        }
+
+        SECTION("run_loop dispatches schedulables from other thread with any strategy")
+        {
+            const auto         scheduler = rpp::schedulers::run_loop{idle};
+            constexpr size_t   count     = 10;
+            std::atomic_size_t executed{};
+
+            std::thread dispatcher{[&] {
+                while (executed.load() != count)
+                    scheduler.dispatch();
+            }};
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                // wait till dispatching thread processed previous schedulable and went idle again
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                scheduler.create_worker().schedule([&executed](const auto&) {
+                    executed.fetch_add(1);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                                   obs);
+            }
+            dispatcher.join();
+            CHECK(executed.load() == count);
+        }
+    }
+}
+
+TEST_CASE("timer_precision")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    constexpr auto delay = std::chrono::milliseconds{2};
+
+    SECTION("precise timer is applied to current thread")
+    {
+        CHECK(!rpp::schedulers::timer_precision{}.is_precise());
+        CHECK(rpp::schedulers::timer_precision::precise(std::chrono::microseconds{50}).get_spin_window() == rpp::schedulers::duration{std::chrono::microseconds{50}});
+
+        rpp::schedulers::timer_precision::precise().apply_to_current_thread();
+        CHECK(rpp::schedulers::details::s_precise_timer_spin_window == rpp::schedulers::timer_precision::default_spin_window);
+
+        SECTION("current_thread never executes delayed schedulable earlier than planned")
+        {
+            std::vector<rpp::schedulers::time_point> planned{};
+            std::vector<rpp::schedulers::time_point> actual{};
+            auto                                     worker = rpp::schedulers::current_thread::create_worker();
+            worker.schedule([&](const auto&) {
+                for (size_t i = 0; i < 5; ++i)
+                {
+                    planned.push_back(rpp::schedulers::clock_type::now() + delay * (i + 1));
+                    worker.schedule(planned.back(), [&](const auto&) {
+                        actual.push_back(rpp::schedulers::clock_type::now());
+                        return rpp::schedulers::optional_delay_to{};
+                    },
+                                    obs);
+                }
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+
+            REQUIRE(actual.size() == planned.size());
+            for (size_t i = 0; i < actual.size(); ++i)
+                CHECK(actual[i] >= planned[i]);
+        }
+
+        SECTION("immediate re-schedules with precise timer")
+        {
+            size_t     count{};
+            const auto start = rpp::schedulers::clock_type::now();
+            rpp::schedulers::immediate::create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_this_timepoint {
+                if (++count == 3)
+                    return std::nullopt;
+                return rpp::schedulers::delay_from_this_timepoint{delay};
+            },
+                                                                 obs);
+            CHECK(count == 3);
+            CHECK(rpp::schedulers::clock_type::now() - start >= delay * 2);
+        }
+
+        SECTION("run_loop waits for delayed schedulable with precise timer")
+        {
+            const auto scheduler = rpp::schedulers::run_loop{};
+            const auto planned   = rpp::schedulers::clock_type::now() + delay;
+            bool       executed{};
+            scheduler.create_worker().schedule(planned, [&executed](const auto&) {
+                executed = true;
+                return rpp::schedulers::optional_delay_to{};
+            },
+                                               obs);
+            scheduler.dispatch();
+            CHECK(executed);
+            CHECK(rpp::schedulers::clock_type::now() >= planned);
+        }
+
+        rpp::schedulers::timer_precision::standard().apply_to_current_thread();
+        CHECK(!rpp::schedulers::details::s_precise_timer_spin_window.has_value());
+    }
+
+    SECTION("thread-owning schedulers respect thread_config::timer")
+    {
+        rpp::schedulers::thread_config config{};
+        config.timer = rpp::schedulers::timer_precision::precise();
+        CHECK(!config.is_empty());
+
+        const auto check_worker = [&](auto worker) {
+            for (size_t i = 0; i < 5; ++i)
+            {
+                std::promise<rpp::schedulers::time_point> promise{};
+                const auto                                planned = rpp::schedulers::clock_type::now() + delay;
+                worker.schedule(planned, [&promise](const auto&) {
+                    promise.set_value(rpp::schedulers::clock_type::now());
+                    return rpp::schedulers::optional_delay_to{};
+                },
+                                obs);
+                auto future = promise.get_future();
+                REQUIRE(future.wait_for(std::chrono::seconds{1}) == std::future_status::ready);
+                CHECK(future.get() >= planned);
+            }
+
+            // zero-delay schedulable scheduled while thread is waiting for delayed one is not blocked by it
+            auto               d = rpp::composite_disposable_wrapper::make();
+            std::promise<void> promise{};
+            worker.schedule(std::chrono::seconds{10}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, mock_observer_strategy<int>{}.get_observer(d).as_dynamic());
+            worker.schedule([&promise](const auto&) {
+                promise.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+            CHECK(promise.get_future().wait_for(std::chrono::seconds{1}) == std::future_status::ready);
+            d.dispose();
+        };
+
+        SECTION("new_thread")
+        {
+            auto worker = rpp::schedulers::new_thread::create_worker(config);
+            check_worker(worker);
+            worker.get_disposable().dispose();
+        }
+
+        SECTION("work_stealing_pool")
+        {
+            check_worker(rpp::schedulers::work_stealing_pool{2, config}.create_worker());
+        }
+    }
+}
+
+TEST_CASE("virtual_time scheduler")
+{
+    using namespace std::chrono_literals;
+
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    const auto start     = rpp::schedulers::time_point{std::chrono::hours{24}};
+    const auto scheduler = rpp::schedulers::virtual_time{start};
+    auto       worker    = scheduler.create_worker();
+
+    std::vector<std::pair<std::string, rpp::schedulers::time_point>> executions{};
+    const auto                                                        make_fn = [&](std::string name) {
+        return [&executions, &worker, name](const auto&) {
+            executions.emplace_back(name, worker.now());
+            return rpp::schedulers::optional_delay_from_now{};
+        };
+    };
+
+    CHECK(scheduler.now() == start);
+    CHECK(worker.current_time() == start);
+
+    SECTION("schedulables are executed only when scheduler is driven with virtual time equal to their timepoint")
+    {
+        worker.schedule(2h, make_fn("2h"), obs);
+        worker.schedule(1h, make_fn("1h_first"), obs);
+        worker.schedule(1h, make_fn("1h_second"), obs);
+        worker.schedule(start + 3h, make_fn("3h"), obs);
+
+        CHECK(executions.empty());
+        CHECK(scheduler.pending_count() == 4);
+        CHECK(scheduler.next_timepoint() == start + 1h);
+
+        CHECK(scheduler.advance_by(90min) == 2);
+        CHECK(scheduler.now() == start + 90min);
+        CHECK(executions == std::vector<std::pair<std::string, rpp::schedulers::time_point>>{{"1h_first", start + 1h}, {"1h_second", start + 1h}});
+
+        const auto wall_start = std::chrono::steady_clock::now();
+        CHECK(scheduler.run() == 2);
+        CHECK(std::chrono::steady_clock::now() - wall_start < 1h);
+        CHECK(scheduler.now() == start + 3h);
+        CHECK(executions.size() == 4);
+        CHECK(executions[2] == std::pair<std::string, rpp::schedulers::time_point>{"2h", start + 2h});
+        CHECK(executions[3] == std::pair<std::string, rpp::schedulers::time_point>{"3h", start + 3h});
+        CHECK(scheduler.is_empty());
+        CHECK(!scheduler.next_timepoint().has_value());
+    }
+
+    SECTION("schedulables scheduled during execution use virtual time and respect limit of advance")
+    {
+        size_t count{};
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_this_timepoint {
+            executions.emplace_back("periodic", worker.now());
+            if (++count == 5)
+                return std::nullopt;
+            return rpp::schedulers::delay_from_this_timepoint{10s};
+        },
+                        obs);
+
+        CHECK(scheduler.advance_by(25s) == 3);
+        CHECK(executions.back().second == start + 20s);
+        CHECK(scheduler.now() == start + 25s);
+
+        CHECK(scheduler.run(1) == 1);
+        CHECK(scheduler.now() == start + 30s);
+
+        CHECK(scheduler.run() == 1);
+        CHECK(count == 5);
+        CHECK(executions.back().second == start + 40s);
+    }
+
+    SECTION("disposed schedulables are skipped")
+    {
+        auto d = rpp::composite_disposable_wrapper::make();
+        worker.schedule(1s, make_fn("disposed"), mock_observer_strategy<int>{}.get_observer(d).as_dynamic());
+        worker.schedule(2s, make_fn("alive"), obs);
+        d.dispose();
+
+        CHECK(scheduler.next_timepoint() == start + 2s);
+        CHECK(scheduler.run() == 1);
+        CHECK(executions.size() == 1);
+        CHECK(executions[0].first == "alive");
+    }
+
+    SECTION("each instance has its own clock")
+    {
+        const auto other        = rpp::schedulers::virtual_time{};
+        auto       other_worker = other.create_worker();
+        CHECK(worker.current_time() == start);
+        CHECK(other_worker.current_time() == rpp::schedulers::time_point{});
+
+        std::vector<rpp::schedulers::time_point> other_executions{};
+        other_worker.schedule(5s, [&](const auto&) {
+            other_executions.push_back(other_worker.now());
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                              obs);
+        worker.schedule(1s, make_fn("1s"), obs);
+
+        CHECK(other.run() == 1);
+        CHECK(other_executions == std::vector{rpp::schedulers::time_point{} + 5s});
+        CHECK(other.now() == rpp::schedulers::time_point{} + 5s);
+        CHECK(other_worker.current_time() == rpp::schedulers::time_point{} + 5s);
+        CHECK(scheduler.now() == start);
+        CHECK(worker.current_time() == start);
+
+        CHECK(scheduler.next_timepoint() == start + 1s);
+        scheduler.run();
+        CHECK(executions[0].second == start + 1s);
+        CHECK(other.now() == rpp::schedulers::time_point{} + 5s);
+    }
+
+    SECTION("operators over different instances are independent")
+    {
+        const auto                                               other = rpp::schedulers::virtual_time{};
+        rpp::subjects::publish_subject<int>                      subject{};
+        std::vector<std::pair<int, rpp::schedulers::time_point>> values{};
+        std::vector<std::pair<int, rpp::schedulers::time_point>> other_values{};
+
+        subject.get_observable()
+            | rpp::operators::delay(1h, scheduler)
+            | rpp::operators::subscribe([&](int v) { values.emplace_back(v, worker.now()); });
+        subject.get_observable()
+            | rpp::operators::debounce(1s, other)
+            | rpp::operators::subscribe([&](int v) { other_values.emplace_back(v, other.now()); });
+
+        subject.get_observer().on_next(1);
+        other.advance_by(2s);
+        subject.get_observer().on_next(2);
+        scheduler.run();
+        other.run();
+
+        CHECK(values == std::vector<std::pair<int, rpp::schedulers::time_point>>{{1, start + 1h}, {2, start + 1h}});
+        CHECK(other_values == std::vector<std::pair<int, rpp::schedulers::time_point>>{{1, rpp::schedulers::time_point{} + 1s}, {2, rpp::schedulers::time_point{} + 3s}});
+    }
+
+    SECTION("throttle and timeout use clock of provided instance")
+    {
+        const auto                          other = rpp::schedulers::virtual_time{};
+        rpp::subjects::publish_subject<int> subject{};
+        std::vector<int>                    throttled{};
+        std::vector<int>                    values{};
+        bool                                timed_out{};
+
+        subject.get_observable()
+            | rpp::operators::throttle(10s, other)
+            | rpp::operators::subscribe([&](int v) { throttled.push_back(v); });
+        subject.get_observable()
+            | rpp::operators::timeout(5s, scheduler)
+            | rpp::operators::subscribe([&](int v) { values.push_back(v); }, [&](const std::exception_ptr&) { timed_out = true; });
+
+        subject.get_observer().on_next(1);
+        scheduler.advance_by(4s);
+        other.advance_by(1h);
+        subject.get_observer().on_next(2);
+
+        CHECK(throttled == std::vector{1, 2});
+        CHECK(values == std::vector{1, 2});
+
+        scheduler.advance_by(4s);
+        subject.get_observer().on_next(3);
+        CHECK(throttled == std::vector{1, 2});
+        CHECK(values == std::vector{1, 2, 3});
+        CHECK(!timed_out);
+
+        scheduler.advance_by(5s);
+        CHECK(timed_out);
+    }
+
+    SECTION("operators work in virtual time")
+    {
+        std::vector<std::pair<int, rpp::schedulers::time_point>> values{};
+        rpp::source::just(1, 2, 3)
+            | rpp::operators::delay(std::chrono::hours{1}, scheduler)
+            | rpp::operators::subscribe([&](int v) { values.emplace_back(v, worker.now()); });
+
+        CHECK(values.empty());
+        scheduler.run();
+        CHECK(values == std::vector<std::pair<int, rpp::schedulers::time_point>>{{1, start + 1h}, {2, start + 1h}, {3, start + 1h}});
+    }
+}
+
+TEST_CASE("new_thread wakes up for delayed schedulable earlier than awaited one")
+{
+    auto obs    = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    auto d      = rpp::composite_disposable_wrapper::make();
+    auto worker = rpp::schedulers::new_thread::create_worker();
+
+    worker.schedule(std::chrono::seconds{10}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, mock_observer_strategy<int>{}.get_observer(d).as_dynamic());
+    // let thread start waiting for the first one
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+    std::promise<void> promise{};
+    worker.schedule(std::chrono::milliseconds{1}, [&promise](const auto&) {
+        promise.set_value();
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                    obs);
+    CHECK(promise.get_future().wait_for(std::chrono::seconds{2}) == std::future_status::ready);
+
+    d.dispose();
+    worker.get_disposable().dispose();
+}
+
+TEST_CASE("new_thread re-queues recursive schedulable after time slice")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    constexpr size_t iterations = 10'000;
+
+    // returns iteration of recursive schedulable when schedulable scheduled via current_thread from inside of it is executed
+    const auto run = [&](const rpp::schedulers::time_slice& slice) {
+        rpp::schedulers::thread_config config{};
+        config.slice      = slice;
+        const auto worker = rpp::schedulers::new_thread::create_worker(config);
+
+        std::promise<size_t> result{};
+        size_t               iteration{};
+        std::atomic_size_t   nested_iteration{iterations};
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            if (iteration == 0)
+            {
+                rpp::schedulers::current_thread::create_worker().schedule([&](const auto&) {
+                    nested_iteration.store(iteration);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                                                          obs);
+            }
+
+            if (++iteration == iterations)
+            {
+                result.set_value(nested_iteration.load());
+                return std::nullopt;
+            }
+            return rpp::schedulers::delay_from_now{};
+        },
+                        obs);
+
+        const auto res = result.get_future().get();
+        worker.get_disposable().dispose();
+        return res;
+    };
+
+    CHECK(run(rpp::schedulers::time_slice::unlimited()) == iterations);
+    CHECK(run(rpp::schedulers::time_slice::items(100)) == 100);
+    CHECK(run(rpp::schedulers::time_slice::of(std::chrono::nanoseconds{1})) < iterations);
+
+    CHECK(rpp::schedulers::thread_config{}.is_empty());
+    rpp::schedulers::thread_config config{};
+    config.slice = rpp::schedulers::time_slice::items(1);
+    CHECK(!config.is_empty());
+}
+
+TEST_CASE("strand serializes schedulables of each worker over shared pool")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    constexpr size_t strands_count = 50;
+    constexpr size_t tasks_count   = 200;
+
+    const auto check_strands = [&](const auto& scheduler) {
+        struct strand_data
+        {
+            std::atomic_bool    is_running{};
+            std::atomic_bool    overlapped{};
+            std::vector<size_t> values{};
+        };
+
+        std::vector<strand_data>  data(strands_count);
+        std::atomic_size_t        executed{};
+        std::mutex                threads_mutex{};
+        std::set<std::thread::id> threads{};
+
+        std::vector<decltype(scheduler.create_worker())> workers{};
+        for (size_t s = 0; s < strands_count; ++s)
+            workers.push_back(scheduler.create_worker());
+
+        for (size_t i = 0; i < tasks_count; ++i)
+        {
+            for (size_t s = 0; s < strands_count; ++s)
+            {
+                workers[s].schedule([&, s, i](const auto&) {
+                    auto& d = data[s];
+                    if (d.is_running.exchange(true))
+                        d.overlapped = true;
+                    d.values.push_back(i);
+                    {
+                        std::lock_guard lock{threads_mutex};
+                        threads.insert(std::this_thread::get_id());
+                    }
+                    d.is_running = false;
+                    executed.fetch_add(1);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                    obs);
+            }
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+        while (executed.load() != strands_count * tasks_count && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+
+        REQUIRE(executed.load() == strands_count * tasks_count);
+        for (const auto& d : data)
+        {
+            CHECK(!d.overlapped);
+            CHECK(std::is_sorted(d.values.begin(), d.values.end()));
+            CHECK(d.values.size() == tasks_count);
+        }
+        CHECK(threads.size() > 1);
+    };
+
+    SECTION("strand over thread_pool")
+    {
+        check_strands(rpp::schedulers::strand{rpp::schedulers::thread_pool{4}});
+    }
+
+    SECTION("strand over work_stealing_pool")
+    {
+        check_strands(rpp::schedulers::strand{rpp::schedulers::work_stealing_pool{4}});
+    }
+
+    SECTION("strand respects delays and recursive scheduling")
+    {
+        const auto worker = rpp::schedulers::strand{rpp::schedulers::thread_pool{2}}.create_worker();
+
+        std::mutex               mutex{};
+        std::vector<std::string> order{};
+        std::promise<void>       done{};
+        const auto               push = [&](std::string v) {
+            std::lock_guard lock{mutex};
+            order.push_back(std::move(v));
+        };
+
+        worker.schedule(std::chrono::milliseconds{20}, [&](const auto&) {
+            push("delayed");
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        size_t count{};
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            push("recursive_" + std::to_string(count));
+            if (++count == 3)
+                return std::nullopt;
+            return rpp::schedulers::delay_from_now{std::chrono::milliseconds{1}};
+        },
+                        obs);
+
+        REQUIRE(done.get_future().wait_for(std::chrono::seconds{2}) == std::future_status::ready);
+        std::lock_guard lock{mutex};
+        CHECK(order == std::vector<std::string>{"recursive_0", "recursive_1", "recursive_2", "delayed"});
+    }
+
+    SECTION("strand skips disposed schedulables")
+    {
+        const auto worker = rpp::schedulers::strand{rpp::schedulers::thread_pool{2}}.create_worker();
+
+        auto               d = rpp::composite_disposable_wrapper::make();
+        std::atomic_bool   disposed_executed{};
+        std::promise<void> done{};
+        worker.schedule(std::chrono::milliseconds{5}, [&](const auto&) {
+            disposed_executed = true;
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        mock_observer_strategy<int>{}.get_observer(d).as_dynamic());
+        d.dispose();
+        worker.schedule(std::chrono::milliseconds{10}, [&](const auto&) {
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        REQUIRE(done.get_future().wait_for(std::chrono::seconds{2}) == std::future_status::ready);
+        CHECK(!disposed_executed);
+    }
+
+    SECTION("strand re-uses one worker of original scheduler for all drains")
+    {
+        const auto worker = rpp::schedulers::strand{rpp::schedulers::new_thread{}}.create_worker();
+
+        std::set<std::thread::id> threads{};
+        std::promise<void>        done{};
+        // more than one batch of drain and some timers
+        worker.schedule([&, count = size_t{}](const auto&) mutable -> rpp::schedulers::optional_delay_from_now {
+            threads.insert(std::this_thread::get_id());
+            if (++count == 200)
+            {
+                done.set_value();
+                return std::nullopt;
+            }
+            return rpp::schedulers::delay_from_now{count % 50 ? std::chrono::nanoseconds{} : std::chrono::milliseconds{1}};
+        },
+                        obs);
+
+        REQUIRE(done.get_future().wait_for(std::chrono::seconds{2}) == std::future_status::ready);
+        CHECK(threads.size() == 1);
+    }
+}
+
+TEST_CASE("elastic scheduler grows under blocking load and shrinks when idle")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    const auto wait_till = [](const auto& condition) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (!condition() && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        return condition();
+    };
+
+    const auto scheduler = rpp::schedulers::elastic{1, 4, std::chrono::milliseconds{50}};
+    CHECK(scheduler.threads_count() == 1);
+
+    SECTION("blocking schedulables occupy threads up to max and rest are queued")
+    {
+        std::promise<void>       release{};
+        const std::shared_future released = release.get_future().share();
+        std::atomic_size_t       started{};
+        std::atomic_size_t       finished{};
+
+        for (size_t i = 0; i < 8; ++i)
+        {
+            scheduler.create_worker().schedule([&, released](const auto&) {
+                started.fetch_add(1);
+                released.wait();
+                finished.fetch_add(1);
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                                               obs);
+        }
+
+        CHECK(wait_till([&] { return started.load() == 4; }));
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        CHECK(started.load() == 4);
+        CHECK(scheduler.threads_count() == 4);
+
+        release.set_value();
+        CHECK(wait_till([&] { return finished.load() == 8; }));
+
+        // extra threads exit after idle timeout
+        CHECK(wait_till([&] { return scheduler.threads_count() == 1; }));
+    }
+
+    SECTION("schedulables of the same worker are serialized and keep order including delayed ones")
+    {
+        const auto worker = scheduler.create_worker();
+
+        std::mutex          mutex{};
+        std::vector<size_t> order{};
+        std::atomic_bool    is_running{};
+        std::atomic_bool    overlapped{};
+        std::promise<void>  done{};
+
+        worker.schedule(std::chrono::milliseconds{20}, [&](const auto&) {
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            worker.schedule([&, i](const auto&) {
+                if (is_running.exchange(true))
+                    overlapped = true;
+                {
+                    std::lock_guard lock{mutex};
+                    order.push_back(i);
+                }
+                is_running = false;
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+        }
+
+        REQUIRE(done.get_future().wait_for(std::chrono::seconds{2}) == std::future_status::ready);
+        std::lock_guard lock{mutex};
+        CHECK(!overlapped);
+        CHECK(order.size() == 100);
+        CHECK(std::is_sorted(order.begin(), order.end()));
+    }
+
+    SECTION("threads woken up by timers don't steal wakeups of ready schedulables")
+    {
+        for (size_t iteration = 0; iteration < 20; ++iteration)
+        {
+            std::promise<void>       release{};
+            const std::shared_future released = release.get_future().share();
+            std::atomic_size_t       started{};
+            std::atomic_size_t       finished{};
+
+            // idle thread wakes up by timer around the same time as ready schedulables are scheduled
+            scheduler.create_worker().schedule(std::chrono::microseconds{500}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+            std::this_thread::sleep_for(std::chrono::microseconds{400});
+
+            for (size_t i = 0; i < 4; ++i)
+            {
+                scheduler.create_worker().schedule([&, released](const auto&) {
+                    started.fetch_add(1);
+                    released.wait();
+                    finished.fetch_add(1);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                                   obs);
+            }
+
+            // all of them are blocked till release, so pool has to grow up to max threads
+            CHECK(wait_till([&] { return started.load() == 4; }));
+            release.set_value();
+            CHECK(wait_till([&] { return finished.load() == 4; }));
+        }
+    }
+
+    SECTION("pool without alive threads creates thread for delayed schedulable")
+    {
+        const auto empty_pool = rpp::schedulers::elastic{0, 2, std::chrono::milliseconds{10}};
+        CHECK(empty_pool.threads_count() == 0);
+
+        std::promise<void> done{};
+        empty_pool.create_worker().schedule(std::chrono::milliseconds{5}, [&](const auto&) {
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                            obs);
+        CHECK(done.get_future().wait_for(std::chrono::seconds{2}) == std::future_status::ready);
+        CHECK(wait_till([&] { return empty_pool.threads_count() == 0; }));
+    }
+}
+
+TEST_CASE("clocks")
+{
+    const auto check_clock = [](auto clock) {
+        const auto before = rpp::schedulers::clock_type::now();
+        const auto value  = decltype(clock)::now();
+        const auto after  = rpp::schedulers::clock_type::now();
+
+        // coarse clock lags up to its resolution, tsc one has small calibration error
+        CHECK(value >= before - std::chrono::milliseconds{50});
+        CHECK(value <= after + std::chrono::milliseconds{50});
+        CHECK(decltype(clock)::now() >= value);
+    };
+
+    SECTION("precise_clock")
+    {
+        check_clock(rpp::schedulers::precise_clock{});
+    }
+    SECTION("coarse_clock")
+    {
+        check_clock(rpp::schedulers::coarse_clock{});
+    }
+    SECTION("tsc_clock")
+    {
+        check_clock(rpp::schedulers::tsc_clock{});
+    }
+    SECTION("cached_clock")
+    {
+        check_clock(rpp::schedulers::cached_clock{});
+    }
+
+    SECTION("cached_clock keeps value during schedulable and refreshes it for next one")
+    {
+        auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+        std::vector<rpp::schedulers::time_point> values{};
+        const auto                               fn = [&values](const auto&) {
+            values.push_back(rpp::schedulers::cached_clock::now());
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            values.push_back(rpp::schedulers::cached_clock::now());
+            return rpp::schedulers::optional_delay_from_now{};
+        };
+
+        const auto worker = rpp::schedulers::current_thread::create_worker();
+        worker.schedule([&](const auto&) {
+            worker.schedule(fn, obs);
+            worker.schedule(fn, obs);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        REQUIRE(values.size() == 4);
+        CHECK(values[0] == values[1]);
+        CHECK(values[2] == values[3]);
+        CHECK(values[2] > values[1]);
+
+        // outside of scheduler loop it is not cached
+        const auto outside = rpp::schedulers::cached_clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        CHECK(rpp::schedulers::cached_clock::now() > outside);
+    }
+}
+
+namespace
+{
+    struct fixed_clock
+    {
+        static rpp::schedulers::time_point now() { return rpp::schedulers::time_point{std::chrono::hours{1}}; }
+    };
+} // namespace
+
+TEST_CASE("with_clock uses provided clock for now and delegates scheduling")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    SECTION("now is obtained from provided clock")
+    {
+        using scheduler = rpp::schedulers::with_clock<fixed_clock, rpp::schedulers::immediate>;
+        CHECK(rpp::schedulers::utils::get_worker_t<scheduler>::now() == fixed_clock::now());
+        static_assert(rpp::schedulers::utils::get_worker_t<scheduler>::is_none_disposable);
+    }
+
+    SECTION("scheduling is performed by original scheduler")
+    {
+        const auto worker = rpp::schedulers::with_clock<rpp::schedulers::cached_clock, rpp::schedulers::new_thread>{}.create_worker();
+
+        std::promise<std::thread::id> promise{};
+        worker.schedule(std::chrono::milliseconds{1}, [&promise](const auto&) {
+            promise.set_value(std::this_thread::get_id());
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        CHECK(promise.get_future().get() != std::this_thread::get_id());
+        worker.get_disposable().dispose();
+    }
+
+    SECTION("operators use provided clock")
+    {
+        std::vector<int> values{};
+        rpp::source::just(1, 2, 3)
+            | rpp::operators::delay(std::chrono::milliseconds{1}, rpp::schedulers::with_clock<rpp::schedulers::coarse_clock, rpp::schedulers::new_thread>{})
+            | rpp::operators::as_blocking()
+            | rpp::operators::subscribe([&values](int v) { values.push_back(v); });
+
+        CHECK(values == std::vector{1, 2, 3});
+    }
+}
+
+TEST_CASE("instrumented scheduler collects metrics")
+{
+    auto       obs     = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    const auto metrics = std::make_shared<rpp::schedulers::scheduler_metrics>();
+
+    SECTION("run_loop")
+    {
+        const auto run_loop  = rpp::schedulers::run_loop{};
+        const auto scheduler = rpp::schedulers::instrumented{run_loop, metrics};
+        const auto worker    = scheduler.create_worker();
+
+        size_t executions{};
+        for (size_t i = 0; i < 3; ++i)
+        {
+            worker.schedule([&executions](const auto&) {
+                ++executions;
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+        }
+
+        CHECK(metrics->pending_count() == 3);
+        CHECK(metrics->max_depth() == 3);
+
+        worker.schedule([&executions, count = 0](const auto&) mutable {
+            ++executions;
+            if (++count == 3)
+                return rpp::schedulers::optional_delay_from_now{};
+            return rpp::schedulers::optional_delay_from_now{std::chrono::nanoseconds{}};
+        },
+                        obs);
+        CHECK(metrics->pending_count() == 4);
+
+        while (!run_loop.is_empty())
+            run_loop.dispatch();
+
+        CHECK(executions == 6);
+        CHECK(metrics->executed_count() == 6);
+        CHECK(metrics->pending_count() == 0);
+        CHECK(metrics->lateness().count() == 6);
+        CHECK(metrics->execution_time().count() == 6);
+        CHECK(metrics->busy_time() <= metrics->uptime());
+        CHECK(metrics->tasks_per_second() > 0);
+    }
+
+    SECTION("dropped schedulables are not pending anymore")
+    {
+        const auto run_loop = rpp::schedulers::run_loop{};
+        const auto worker   = rpp::schedulers::instrumented{run_loop, metrics}.create_worker();
+
+        auto d              = rpp::composite_disposable_wrapper::make();
+        auto disposable_obs = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+        worker.schedule([](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, disposable_obs);
+        CHECK(metrics->pending_count() == 1);
+
+        d.dispose();
+        run_loop.dispatch_if_ready();
+
+        CHECK(metrics->pending_count() == 0);
+        CHECK(metrics->executed_count() == 0);
+    }
+
+    SECTION("new_thread measures lateness against scheduled timepoint")
+    {
+        const auto worker = rpp::schedulers::instrumented{rpp::schedulers::new_thread{}, metrics}.create_worker();
+
+        std::promise<void> promise{};
+        worker.schedule(std::chrono::milliseconds{10}, [&promise](const auto&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            promise.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        promise.get_future().wait();
+        worker.get_disposable().dispose();
+
+        CHECK(metrics->lateness().count() == 1);
+        CHECK(metrics->lateness().percentile(1.0) < std::chrono::milliseconds{10});
+        CHECK(metrics->execution_time().percentile(1.0) >= std::chrono::milliseconds{1});
+        CHECK(metrics->idle_time() > std::chrono::milliseconds{5});
+    }
+
+    SECTION("lateness is measured by clock of original scheduler")
+    {
+        const auto virtual_time = rpp::schedulers::virtual_time{};
+        const auto worker       = rpp::schedulers::instrumented{virtual_time, metrics}.create_worker();
+
+        worker.schedule(std::chrono::seconds{10}, [count = 0](const auto&) mutable {
+            if (++count == 3)
+                return rpp::schedulers::optional_delay_from_now{};
+            return rpp::schedulers::optional_delay_from_now{std::chrono::seconds{1}};
+        },
+                        obs);
+        virtual_time.run();
+
+        CHECK(metrics->executed_count() == 3);
+        CHECK(metrics->lateness().count() == 3);
+        CHECK(metrics->lateness().percentile(1.0) == rpp::schedulers::duration{});
+        CHECK(metrics->execution_time().percentile(1.0) == rpp::schedulers::duration{});
+    }
+
+    SECTION("histogram percentiles")
+    {
+        rpp::schedulers::scheduler_metrics::histogram histogram{};
+        for (size_t i = 0; i < 99; ++i)
+            histogram.add(std::chrono::nanoseconds{100});
+        histogram.add(std::chrono::milliseconds{1});
+
+        CHECK(histogram.count() == 100);
+        CHECK(histogram.percentile(0.5) == std::chrono::nanoseconds{128});
+        CHECK(histogram.percentile(0.99) == std::chrono::nanoseconds{128});
+        CHECK(histogram.percentile(1.0) == std::chrono::nanoseconds{1 << 20});
+    }
+}
+
+TEST_CASE("work_stealing_pool executes other workers while one worker is busy")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::work_stealing_pool{2};
+
+    std::atomic_bool first_job_done{};
+
+    // workers scheduled from outside of pool are pushed to deques in round-robin manner, so some of them are pushed to deque of blocked thread and should be stolen by another one
+    scheduler.create_worker().schedule([&first_job_done](const auto&) {
+        while (!first_job_done)
+            std::this_thread::yield();
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                                       obs);
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        std::promise<bool> task_executed_promise{};
+        scheduler.create_worker().schedule([&task_executed_promise](const auto&) {
+            task_executed_promise.set_value(true);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                           obs);
+
+        auto f = task_executed_promise.get_future();
+        CHECK(f.wait_for(std::chrono::seconds{1}) == std::future_status::ready);
+    }
+
+    first_job_done.store(true);
+}
+
+TEST_CASE("work_stealing_pool keeps order of schedulables of the same worker")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::work_stealing_pool{4};
+
+    constexpr size_t    workers_count = 8;
+    constexpr size_t    tasks_count   = 1000;
+    std::atomic_size_t  finished{};
+    std::promise<void>  all_finished{};
+    std::vector<size_t> last_values(workers_count);
+    std::atomic_bool    order_violated{};
+    std::atomic_bool    parallel_execution{};
+
+    std::vector<std::unique_ptr<std::atomic_bool>> is_running{};
+    for (size_t i = 0; i < workers_count; ++i)
+        is_running.push_back(std::make_unique<std::atomic_bool>());
+
+    std::vector<decltype(scheduler.create_worker())> workers{};
+    for (size_t i = 0; i < workers_count; ++i)
+        workers.push_back(scheduler.create_worker());
+
+    for (size_t v = 1; v <= tasks_count; ++v)
+    {
+        for (size_t i = 0; i < workers_count; ++i)
+        {
+            workers[i].schedule([&, i, v](const auto&) {
+                if (is_running[i]->exchange(true))
+                    parallel_execution.store(true);
+
+                if (std::exchange(last_values[i], v) != v - 1)
+                    order_violated.store(true);
+
+                is_running[i]->store(false);
+                if (++finished == workers_count * tasks_count)
+                    all_finished.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                                obs);
+        }
+    }
+
+    REQUIRE(all_finished.get_future().wait_for(std::chrono::seconds{10}) == std::future_status::ready);
+    CHECK(!order_violated);
+    CHECK(!parallel_execution);
+}
+
+TEST_CASE("work_stealing_pool drops pending delayed schedulables on destruction")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::atomic_bool   delayed_executed{};
+    std::promise<void> immediate_executed{};
+    {
+        auto scheduler = rpp::schedulers::work_stealing_pool{2};
+        auto worker    = scheduler.create_worker();
+
+        worker.schedule(std::chrono::hours{1}, [&delayed_executed](const auto&) {
+            delayed_executed.store(true);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        scheduler.create_worker().schedule([&immediate_executed](const auto&) {
+            immediate_executed.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                           obs);
+        immediate_executed.get_future().get();
+    }
+
+    // destructor of the pool joined its threads without waiting for timer
+    CHECK(!delayed_executed);
+}
+
+TEST_CASE("work_stealing_pool allows destructors of disposed schedulables to schedule to the same worker")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::work_stealing_pool{2};
+    auto worker    = scheduler.create_worker();
+
+    std::promise<void> done{};
+
+    struct schedule_on_destruction
+    {
+        schedule_on_destruction(decltype(worker)& w, std::promise<void>& p, rpp::dynamic_observer<int> o)
+            : target{&w}
+            , promise{&p}
+            , obs{std::move(o)}
+        {
+        }
+
+        schedule_on_destruction(schedule_on_destruction&& other) noexcept
+            : target{std::exchange(other.target, nullptr)}
+            , promise{other.promise}
+            , obs{other.obs}
+        {
+        }
+
+        ~schedule_on_destruction() noexcept
+        {
+            if (!target)
+                return;
+
+            target->schedule([p = promise](const auto&) {
+                p->set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                             obs);
+        }
+
+        decltype(worker)*          target;
+        std::promise<void>*        promise;
+        rpp::dynamic_observer<int> obs;
+    };
+
+    auto d = rpp::composite_disposable_wrapper::make();
+    worker.schedule(std::chrono::milliseconds{10}, [guard = schedule_on_destruction{worker, done, obs}](const auto&) {
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                    mock_observer_strategy<int>{}.get_observer(d).as_dynamic());
+    d.dispose();
+
+    CHECK(done.get_future().wait_for(std::chrono::seconds{2}) == std::future_status::ready);
+}
+
+TEST_CASE("work_stealing_pool respects delays and recursive scheduling")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::work_stealing_pool{2};
+    auto worker    = scheduler.create_worker();
+
+    SECTION("delayed schedulable executed not earlier than requested")
+    {
+        std::promise<rpp::schedulers::time_point> executed{};
+        const auto                                start = rpp::schedulers::clock_type::now();
+        worker.schedule(std::chrono::milliseconds{50}, [&executed](const auto&) {
+            executed.set_value(rpp::schedulers::clock_type::now());
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        CHECK(executed.get_future().get() - start >= std::chrono::milliseconds{50});
+    }
+
+    SECTION("earlier schedulable executed before delayed one")
+    {
+        std::mutex               mutex{};
+        std::vector<std::string> executions{};
+        std::promise<void>       done{};
+
+        worker.schedule(std::chrono::milliseconds{50}, [&](const auto&) {
+            {
+                std::lock_guard lock{mutex};
+                executions.push_back("delayed");
+            }
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        worker.schedule([&](const auto&) {
+            std::lock_guard lock{mutex};
+            executions.push_back("immediate");
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        done.get_future().get();
+        std::lock_guard lock{mutex};
+        CHECK(executions == std::vector<std::string>{"immediate", "delayed"});
+    }
+
+    SECTION("recursive schedulable re-scheduled till requested")
+    {
+        std::promise<void> done{};
+        size_t             counter{};
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            if (++counter < 200)
+                return rpp::schedulers::delay_from_now{counter % 2 ? std::chrono::nanoseconds{} : std::chrono::nanoseconds{100}};
+            done.set_value();
+            return std::nullopt;
+        },
+                        obs);
+
+        done.get_future().get();
+        CHECK(counter == 200);
+    }
+}
+
+TEST_CASE("schedulables_queue keeps order by timepoint and FIFO for equal timepoints")
+{
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::immediate::worker_strategy> queue{};
+
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> executions{};
+    const auto       schedule = [&](rpp::schedulers::time_point tp, int v) {
+        queue.emplace(tp, [&executions, v](const auto&) { executions.push_back(v); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    };
+
+    const auto now = rpp::schedulers::clock_type::now();
+    schedule(now + std::chrono::seconds{3}, 5);
+    schedule(now + std::chrono::seconds{1}, 1);
+    schedule(now + std::chrono::seconds{2}, 3);
+    schedule(now + std::chrono::seconds{1}, 2);
+    schedule(now + std::chrono::seconds{2}, 4);
+    schedule(now + std::chrono::seconds{3}, 6);
+
+    SECTION("pop returns schedulables in order")
+    {
+        while (!queue.is_empty())
+            (*queue.pop())();
+
+        CHECK(executions == std::vector{1, 2, 3, 4, 5, 6});
+    }
+
+    SECTION("re-emplaced schedulable placed after already scheduled ones with same timepoint")
+    {
+        auto top = queue.pop();
+        (*top)();
+        queue.emplace(now + std::chrono::seconds{2}, std::move(top));
+
+        while (!queue.is_empty())
+            (*queue.pop())();
+
+        CHECK(executions == std::vector{1, 2, 3, 4, 1, 5, 6});
+    }
+}
+
+TEST_CASE("schedulables_queue removes disposed schedulables before they reach the top")
+{
+    struct handler
+    {
+        std::shared_ptr<bool> disposed = std::make_shared<bool>();
+
+        bool is_disposed() const { return *disposed; }
+        void on_error(const std::exception_ptr&) const {}
+    };
+
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::immediate::worker_strategy> queue{};
+
+    const auto       now   = rpp::schedulers::clock_type::now();
+    const auto       state = std::make_shared<int>();
+    std::vector<int> executions{};
+
+    // alive schedulables interleaved with a lot of disposed ones with same timepoints
+    for (int i = 0; i < 1000; ++i)
+    {
+        handler h{};
+        queue.emplace(now + std::chrono::seconds{i % 10}, [&executions, i, state](const auto&) { executions.push_back(i); return rpp::schedulers::optional_delay_from_now{}; }, h);
+        *h.disposed = i % 100 != 0;
+    }
+
+    CHECK(queue.size() < 300);
+    CHECK(state.use_count() < 300);
+
+    while (!queue.is_empty())
+    {
+        auto top = queue.pop();
+        if (!top->is_disposed())
+            (*top)();
+    }
+
+    CHECK(executions == std::vector{0, 100, 200, 300, 400, 500, 600, 700, 800, 900});
+    CHECK(state.use_count() == 1);
+}
+
+TEST_CASE("schedulables_queue keeps amount of disposed timers bounded by alive ones")
+{
+    // "timeout(30s)" model: most of timers are disposed long before they reach the top of the queue
+    constexpr size_t alive_count = 1'000;
+
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::immediate::worker_strategy> queue{};
+    const auto                                                                                fn            = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+    const auto                                                                                alive_handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+
+    const auto start = rpp::schedulers::clock_type::now();
+    for (size_t i = 0; i < alive_count; ++i)
+        queue.emplace(start + std::chrono::seconds{30}, fn, alive_handler);
+
+    for (size_t round = 0; round < 100; ++round)
+    {
+        for (size_t i = 0; i < 1'000; ++i)
+        {
+            const auto handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            queue.emplace(start + std::chrono::seconds{30}, fn, handler);
+            handler.on_completed();
+        }
+        CHECK(queue.size() < 2 * alive_count);
+    }
+}
+
+TEST_CASE("prioritized_schedulables_queue selects ready schedulables of higher priority first")
+{
+    using rpp::schedulers::priority;
+
+    rpp::schedulers::details::prioritized_schedulables_queue<rpp::schedulers::immediate::worker_strategy> queue{};
+
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> executions{};
+    const auto       schedule = [&](rpp::schedulers::time_point tp, priority p, int v) {
+        queue.emplace(tp, p, [&executions, v](const auto&) { executions.push_back(v); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    };
+    const auto execute_ready = [&](rpp::schedulers::time_point now) {
+        while (auto* lane = queue.select_ready(now))
+            (*lane->pop())();
+    };
+
+    const auto now = rpp::schedulers::clock_type::now();
+
+    SECTION("ready schedulables are selected by priority, then by timepoint")
+    {
+        schedule(now - std::chrono::seconds{3}, priority::low, 1);
+        schedule(now - std::chrono::seconds{2}, priority::normal, 2);
+        schedule(now - std::chrono::seconds{1}, priority::high, 3);
+        schedule(now - std::chrono::seconds{2}, priority::high, 4);
+        schedule(now + std::chrono::seconds{1}, priority::high, 5);
+
+        CHECK(queue.size() == 5);
+        CHECK(queue.has_prioritized());
+        CHECK(queue.earliest_timepoint() == now - std::chrono::seconds{3});
+
+        execute_ready(now);
+        CHECK(executions == std::vector{4, 3, 2, 1});
+        CHECK(!queue.has_ready(now));
+        CHECK(queue.select_ready(now) == nullptr);
+
+        execute_ready(now + std::chrono::seconds{1});
+        CHECK(executions == std::vector{4, 3, 2, 1, 5});
+        CHECK(queue.is_empty());
+    }
+
+    SECTION("lower priority is not starved")
+    {
+        schedule(now, priority::low, -1);
+        for (int i = 0; i < 100; ++i)
+            schedule(now, priority::high, i);
+
+        execute_ready(now);
+
+        const auto low = std::find(executions.begin(), executions.end(), -1);
+        REQUIRE(low != executions.end());
+        CHECK(static_cast<size_t>(std::distance(executions.begin(), low)) == decltype(queue)::max_skips_in_row);
+    }
+
+    SECTION("re-emplaced schedulable keeps its priority")
+    {
+        schedule(now, priority::high, 1);
+        schedule(now, priority::normal, 2);
+
+        auto* lane = queue.select_ready(now);
+        REQUIRE(lane == &queue.get_lane(priority::high));
+        queue.emplace(now, lane->pop());
+
+        CHECK(queue.select_ready(now) == &queue.get_lane(priority::high));
+    }
+}
+
+TEST_CASE("run_loop and new_thread execute ready schedulables of higher priority first")
+{
+    using rpp::schedulers::priority;
+
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::mutex       mutex{};
+    std::vector<int> executions{};
+    const auto       make_fn = [&](int v) {
+        return [&, v](const auto&) {
+            std::lock_guard lock{mutex};
+            executions.push_back(v);
+            return rpp::schedulers::optional_delay_from_now{};
+        };
+    };
+
+    SECTION("run_loop")
+    {
+        rpp::schedulers::run_loop loop{};
+        const auto                worker = loop.create_worker();
+
+        for (int i = 0; i < 10; ++i)
+            worker.schedule(make_fn(i), obs);
+        worker.schedule(priority::low, make_fn(-1), obs);
+        worker.schedule(priority::high, make_fn(100), obs);
+        rpp::schedulers::with_priority{loop}.create_worker().schedule(make_fn(101), obs);
+
+        loop.dispatch_batch();
+
+        CHECK(executions == std::vector{100, 101, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, -1});
+    }
+
+    SECTION("new_thread")
+    {
+        const auto worker = rpp::schedulers::new_thread::create_worker();
+
+        std::promise<void> started{};
+        std::promise<void> release{};
+        worker.schedule([&, future = release.get_future().share()](const auto&) {
+            started.set_value();
+            future.wait();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        started.get_future().wait();
+
+        for (int i = 0; i < 10; ++i)
+            worker.schedule(make_fn(i), obs);
+        worker.schedule(priority::low, make_fn(-1), obs);
+        worker.schedule(priority::high, make_fn(100), obs);
+
+        std::promise<void> done{};
+        worker.schedule(priority::low, [&](const auto&) {
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        release.set_value();
+        done.get_future().wait();
+
+        std::lock_guard lock{mutex};
+        CHECK(executions == std::vector{100, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, -1});
+        worker.get_disposable().dispose();
+    }
+
+    SECTION("priority is ignored by schedulers without priorities")
+    {
+        const auto worker = rpp::schedulers::with_priority{rpp::schedulers::current_thread{}, priority::low}.create_worker();
+        worker.schedule(make_fn(1), obs);
+        CHECK(executions == std::vector{1});
+    }
+}
+
+TEST_CASE("mpsc_schedulables_queue keeps FIFO order")
+{
+    rpp::schedulers::details::mpsc_schedulables_queue<rpp::schedulers::immediate::worker_strategy> queue{};
+
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> executions{};
+    const auto       schedule = [&](int v) {
+        queue.emplace(rpp::schedulers::clock_type::now(), [&executions, v](const auto&) { executions.push_back(v); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    };
+
+    CHECK(queue.is_empty());
+
+    schedule(1);
+    schedule(2);
+    CHECK(queue.size() == 2);
+
+    (*queue.pop())();
+    // new schedulables pushed while consumer still has grabbed ones
+    schedule(3);
+    schedule(4);
+
+    while (!queue.is_empty())
+        (*queue.pop())();
+
+    CHECK(executions == std::vector{1, 2, 3, 4});
+    CHECK(queue.size() == 0);
+
+    SECTION("not popped schedulables destroyed with queue")
+    {
+        schedule(5);
+    }
+}
+
+TEST_CASE("new_thread keeps order of zero-delay schedulables from multiple producers")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto worker = rpp::schedulers::new_thread::create_worker();
+
+    constexpr size_t                 producers_count = 4;
+    constexpr size_t                 tasks_count     = 1000;
+    std::vector<std::vector<size_t>> executions(producers_count);
+    std::atomic_size_t               executed{};
+
+    std::vector<std::thread> producers{};
+    for (size_t i = 0; i < producers_count; ++i)
+    {
+        producers.emplace_back([&, i] {
+            for (size_t v = 0; v < tasks_count; ++v)
+            {
+                // mix timed schedulables too to be sure both queues are processed
+                worker.schedule(v % 10 == 0 ? std::chrono::microseconds{10} : std::chrono::microseconds{0}, [&, i, v](const auto&) {
+                    executions[i].push_back(v);
+                    ++executed;
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                obs);
+            }
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    while (executed.load() != producers_count * tasks_count)
+        std::this_thread::yield();
+
+    for (const auto& values : executions)
+    {
+        std::vector<size_t> zero_delay_values{};
+        std::copy_if(values.cbegin(), values.cend(), std::back_inserter(zero_delay_values), [](size_t v) { return v % 10 != 0; });
+        CHECK(values.size() == tasks_count);
+        CHECK(std::is_sorted(zero_delay_values.cbegin(), zero_delay_values.cend()));
+    }
+}
+
+TEST_CASE("schedulables_pool re-uses freed blocks")
+{
+    using pool = rpp::schedulers::details::schedulables_pool;
+
+    SECTION("block of same bucket re-used after deallocation")
+    {
+        void* ptr = pool::allocate(40);
+        pool::deallocate(ptr, 40);
+
+        void* other = pool::allocate(60);
+        CHECK(other == ptr);
+        pool::deallocate(other, 60);
+    }
+
+    SECTION("block of other bucket not re-used")
+    {
+        void* ptr = pool::allocate(40);
+        void* big = pool::allocate(pool::block_granularity * 2);
+        pool::deallocate(ptr, 40);
+
+        void* other = pool::allocate(pool::block_granularity * 2);
+        CHECK(other != ptr);
+        pool::deallocate(other, pool::block_granularity * 2);
+        pool::deallocate(big, pool::block_granularity * 2);
+    }
+
+    SECTION("blocks bigger than max size bypass pool")
+    {
+        void* ptr = pool::allocate(pool::max_block_size + 1);
+        CHECK(ptr != nullptr);
+        pool::deallocate(ptr, pool::max_block_size + 1);
+    }
+}
+
+TEST_CASE("schedulables_pool keeps scheduling allocation-free in steady state")
+{
+    const auto fn      = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+    const auto handler = rpp::make_lambda_observer([](int) {}).as_dynamic();
+
+    SECTION("schedulables scheduled and executed by same thread")
+    {
+        rpp::schedulers::details::schedulables_queue<rpp::schedulers::immediate::worker_strategy> queue{};
+        const auto                                                                                run = [&] {
+            for (size_t i = 0; i < 100; ++i)
+                queue.emplace(rpp::schedulers::clock_type::now(), fn, handler);
+            while (!queue.is_empty())
+                queue.pop();
+        };
+
+        run();
+
+        s_allocations_count = 0;
+        run();
+        CHECK(s_allocations_count == 0);
+    }
+
+    SECTION("schedulables scheduled by one thread and executed by other one")
+    {
+        const auto       worker = rpp::schedulers::new_thread::create_worker();
+        std::atomic_bool done{};
+        const auto       run = [&] {
+            for (size_t i = 0; i < 100; ++i)
+            {
+                done.store(false);
+                worker.schedule([&](const auto&) {
+                    done.store(true);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                handler);
+                while (!done.load())
+                    std::this_thread::yield();
+            }
+        };
+
+        // few schedulables in-flight at the same time to have enough of blocks in pool of this thread
+        std::atomic_size_t executed{};
+        for (size_t i = 0; i < 10; ++i)
+        {
+            worker.schedule([&](const auto&) {
+                executed.fetch_add(1);
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            handler);
+        }
+        while (executed.load() != 10)
+            std::this_thread::yield();
+        run();
+
+        s_allocations_count = 0;
+        run();
+        CHECK(s_allocations_count == 0);
+    }
+
+    SECTION("blocks freed by other thread are returned to allocating thread")
+    {
+        using pool = rpp::schedulers::details::schedulables_pool;
+
+        std::vector<void*> blocks(pool::max_cached_blocks);
+        for (auto& ptr : blocks)
+            ptr = pool::allocate(40);
+        std::thread{[&blocks] {
+            for (void* ptr : blocks)
+                pool::deallocate(ptr, 40);
+        }}.join();
+
+        s_allocations_count = 0;
+        for (auto& ptr : blocks)
+            ptr = pool::allocate(40);
+        CHECK(s_allocations_count == 0);
+
+        for (void* ptr : blocks)
+            pool::deallocate(ptr, 40);
+    }
+
+    SECTION("block can be freed after exit of allocating thread")
+    {
+        using pool = rpp::schedulers::details::schedulables_pool;
+
+        void* ptr{};
+        std::thread{[&ptr] { ptr = pool::allocate(40); }}.join();
+        pool::deallocate(ptr, 40);
+    }
+}
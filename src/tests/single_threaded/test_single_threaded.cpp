@@ -0,0 +1,132 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/rpp.hpp>
+
+#include "snitch_logging.hpp"
+
+#include <type_traits>
+
+#if !defined(RPP_SINGLE_THREADED)
+    #error "test is expected to be compiled with RPP_SINGLE_THREADED"
+#endif
+
+static_assert(rpp::utils::is_single_threaded);
+static_assert(std::is_same_v<rpp::utils::mutex, rpp::utils::none_mutex>);
+static_assert(std::is_same_v<rpp::utils::atomic<size_t>, rpp::utils::non_atomic<size_t>>);
+
+TEST_CASE("non_atomic provides same semantic as std::atomic")
+{
+    rpp::utils::non_atomic<size_t> value{1};
+
+    CHECK(value.fetch_add(2) == 1);
+    CHECK(value.fetch_sub(1) == 3);
+    CHECK(value.exchange(5) == 2);
+
+    size_t expected = 4;
+    CHECK(!value.compare_exchange_strong(expected, 10));
+    CHECK(expected == 5);
+    CHECK(value.compare_exchange_weak(expected, 10));
+    CHECK(value.load() == 10);
+}
+
+TEST_CASE("disposables work in single-threaded mode")
+{
+    auto composite = rpp::composite_disposable_wrapper::make();
+    auto child     = rpp::composite_disposable_wrapper::make();
+    auto other     = rpp::composite_disposable_wrapper::make();
+
+    composite.add(child);
+    composite.add(other);
+    composite.remove(other);
+
+    auto refcount = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+    refcount.add(composite);
+    auto first  = refcount.lock()->add_ref();
+    auto second = refcount.lock()->add_ref();
+
+    first.dispose();
+    CHECK(!composite.is_disposed());
+
+    second.dispose();
+    CHECK(composite.is_disposed());
+    CHECK(child.is_disposed());
+    CHECK(!other.is_disposed());
+}
+
+TEST_CASE("operators work in single-threaded mode")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    SECTION("merge of subjects")
+    {
+        rpp::subjects::publish_subject<int> first{};
+        rpp::subjects::publish_subject<int> second{};
+
+        first.get_observable() | rpp::ops::merge_with(second.get_observable()) | rpp::ops::subscribe(mock);
+
+        first.get_observer().on_next(1);
+        second.get_observer().on_next(2);
+        first.get_observer().on_completed();
+        CHECK(mock.get_on_completed_count() == 0);
+
+        second.get_observer().on_next(3);
+        second.get_observer().on_completed();
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("concat, combine_latest and with_latest_from")
+    {
+        rpp::source::just(rpp::source::just(1, 2).as_dynamic(), rpp::source::concat(rpp::source::just(3)).as_dynamic())
+            | rpp::ops::concat()
+            | rpp::ops::combine_latest([](int l, int r) { return l * 10 + r; }, rpp::source::just(5))
+            | rpp::ops::with_latest_from([](int l, int r) { return l + r; }, rpp::source::just(100))
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{115, 125, 135});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("publish + ref_count and replay_subject")
+    {
+        rpp::subjects::replay_subject<int> subject{};
+        const auto                         shared = subject.get_observable() | rpp::ops::publish() | rpp::ops::ref_count();
+
+        subject.get_observer().on_next(1);
+        shared.subscribe(mock);
+        shared.subscribe(mock);
+        subject.get_observer().on_next(2);
+        subject.get_observer().on_completed();
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 2});
+        CHECK(mock.get_on_completed_count() == 2);
+    }
+
+    SECTION("time-based operators over virtual_time")
+    {
+        const auto scheduler = rpp::schedulers::virtual_time{};
+
+        rpp::source::just(rpp::schedulers::current_thread{}, 1, 2, 3)
+            | rpp::ops::flat_map([](int v) { return rpp::source::just(v) | rpp::ops::repeat(2); })
+            | rpp::ops::delay(std::chrono::seconds{1}, scheduler)
+            | rpp::ops::debounce(std::chrono::seconds{1}, scheduler)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_total_on_next_count() == 0);
+        scheduler.run();
+
+        CHECK(mock.get_received_values() == std::vector{3});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}